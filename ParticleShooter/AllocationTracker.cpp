@@ -0,0 +1,238 @@
+#include "AllocationTracker.h"
+#include "Stats.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <vector>
+
+const int AllocationTracker::WARM_UP_FRAMES;
+const int AllocationTracker::FLAGGED_FRAME_CAPACITY;
+const char* const AllocationTracker::OUTSIDE_ZONES = "(outside zones)";
+const char* const AllocationTracker::OVERFLOW_ZONE = "(too many zones)";
+
+//Constant initialized, so allocations made before main or during static initialization are safe to record
+std::atomic<bool> AllocationTracker::ENABLED{ false };
+thread_local const char* AllocationTracker::CURRENT_ZONE = nullptr;
+AllocationTracker::ZoneSlot AllocationTracker::ZONES[AllocationTracker::ZONE_CAPACITY];
+std::atomic<std::uint64_t> AllocationTracker::FRAME_ALLOCATIONS{ 0 };
+std::atomic<std::uint64_t> AllocationTracker::FRAME_BYTES{ 0 };
+
+/*
+	Counts every allocation the game makes. The default operator new[] and the sized and array deletes all
+	forward to these two, so replacing them is enough to see everything.
+*/
+void* operator new(std::size_t size)
+{
+	Stats::CountAllocation();
+	AllocationTracker::RecordAllocation(size);
+
+	void* memory = std::malloc(size > 0 ? size : 1);
+	if (memory == nullptr)
+		throw std::bad_alloc();
+
+	return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+/*
+	Description:
+		Charges an allocation to the current frame and the allocating thread's innermost zone. Does nothing while
+		the tracker is disabled. Safe to call from any thread and never allocates.
+
+	Arguments:
+		bytes - Size requested from operator new
+*/
+void AllocationTracker::RecordAllocation(const size_t& bytes)
+{
+	if (!ENABLED.load(std::memory_order_relaxed))
+		return;
+
+	FRAME_ALLOCATIONS.fetch_add(1, std::memory_order_relaxed);
+	FRAME_BYTES.fetch_add(bytes, std::memory_order_relaxed);
+
+	ZoneSlot& zone = FindZone(CURRENT_ZONE != nullptr ? CURRENT_ZONE : OUTSIDE_ZONES);
+	zone._Allocations.fetch_add(1, std::memory_order_relaxed);
+	zone._Bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+/*
+	Description:
+		Finds the zone's slot, claiming an empty one the first time the zone is seen.
+
+	Return:
+		ZoneSlot& - The zone's running totals, or the overflow slot's once every slot is claimed
+*/
+AllocationTracker::ZoneSlot& AllocationTracker::FindZone(const char* name)
+{
+	const size_t start = (reinterpret_cast<std::uintptr_t>(name) >> 3) % (ZONE_CAPACITY - 1);
+
+	//The last slot is kept back for OVERFLOW_ZONE
+	for (int probe = 0; probe < ZONE_CAPACITY - 1; probe++)
+	{
+		ZoneSlot& slot = ZONES[(start + probe) % (ZONE_CAPACITY - 1)];
+
+		const char* claimed = slot._Name.load(std::memory_order_acquire);
+		if (claimed == nullptr && slot._Name.compare_exchange_strong(claimed, name, std::memory_order_acq_rel))
+			return slot;
+		if (claimed == name)
+			return slot;
+	}
+
+	ZoneSlot& overflow = ZONES[ZONE_CAPACITY - 1];
+	overflow._Name.store(OVERFLOW_ZONE, std::memory_order_relaxed);
+	return overflow;
+}
+
+/*
+	Description:
+		Finishes the frame being tracked. Steady state frames that allocated more than the threshold are flagged
+		on stderr and kept for the report.
+
+	Arguments:
+		ticks - Simulation ticks run during the frame
+*/
+void AllocationTracker::EndFrame(const int ticks)
+{
+	if (!IsEnabled())
+		return;
+
+	_lastFrameAllocations = FRAME_ALLOCATIONS.exchange(0, std::memory_order_relaxed);
+	_lastFrameBytes = FRAME_BYTES.exchange(0, std::memory_order_relaxed);
+	_frames++;
+	_ticks += ticks;
+
+	if (_frames == WARM_UP_FRAMES)
+	{
+		for (int zone = 0; zone < ZONE_CAPACITY; zone++)
+		{
+			_warmUpZoneAllocations[zone] = ZONES[zone]._Allocations.load(std::memory_order_relaxed);
+			_warmUpZoneBytes[zone] = ZONES[zone]._Bytes.load(std::memory_order_relaxed);
+		}
+	}
+	if (_frames <= WARM_UP_FRAMES)
+		return;
+
+	_steadyFrames++;
+	_steadyTicks += ticks;
+	_steadyAllocations += _lastFrameAllocations;
+	_steadyBytes += _lastFrameBytes;
+
+	FlaggedFrame frame;
+	frame._Frame = _frames;
+	frame._Ticks = ticks;
+	frame._Allocations = _lastFrameAllocations;
+	frame._Bytes = _lastFrameBytes;
+
+	if (frame._Allocations > _worstFrame._Allocations)
+		_worstFrame = frame;
+
+	if (frame._Allocations <= static_cast<std::uint64_t>(std::max(_frameThreshold, 0)))
+		return;
+
+	//Only the first few are printed. Every one is counted
+	if (_flaggedFrames < FLAGGED_FRAME_CAPACITY)
+	{
+		_flagged[_flaggedFrames] = frame;
+		std::cerr << "Frame " << frame._Frame << " made " << frame._Allocations << " allocations (" << frame._Bytes << " bytes) over "
+			<< frame._Ticks << " ticks" << std::endl;
+	}
+	_flaggedFrames++;
+}
+
+double AllocationTracker::GetSteadyStateAllocationsPerTick() const
+{
+	return _steadyTicks > 0 ? static_cast<double>(_steadyAllocations) / _steadyTicks : 0.0;
+}
+
+/*
+	Description:
+		Prints the steady state allocations per tick and writes the full breakdown as JSON. Zones are listed
+		from most to fewest steady state allocations.
+
+	Arguments:
+		filePath - Where to write the report. Overwritten if it already exists
+
+	Return:
+		bool - Whether or not the report was written
+*/
+bool AllocationTracker::WriteReport(const std::string& filePath) const
+{
+	const double bytesPerTick = _steadyTicks > 0 ? static_cast<double>(_steadyBytes) / _steadyTicks : 0.0;
+
+	std::cout << "Steady state: " << GetSteadyStateAllocationsPerTick() << " allocations (" << bytesPerTick << " bytes) per tick over "
+		<< _steadyTicks << " ticks. " << _flaggedFrames << " frames over " << _frameThreshold << " allocations" << std::endl;
+
+	std::ofstream report(filePath, std::ios::trunc);
+	if (!report)
+		return false;
+
+	struct ZoneTotal
+	{
+		const char* _Name;
+		std::uint64_t _Allocations;
+		std::uint64_t _Bytes;
+		std::uint64_t _SteadyAllocations;
+		std::uint64_t _SteadyBytes;
+	};
+
+	//Before the warm up ends, everything counts as warm up
+	const bool warmedUp = _frames >= WARM_UP_FRAMES;
+
+	std::vector<ZoneTotal> zones;
+	for (int zone = 0; zone < ZONE_CAPACITY; zone++)
+	{
+		const char* name = ZONES[zone]._Name.load(std::memory_order_acquire);
+		if (name == nullptr)
+			continue;
+
+		const std::uint64_t allocations = ZONES[zone]._Allocations.load(std::memory_order_relaxed);
+		const std::uint64_t bytes = ZONES[zone]._Bytes.load(std::memory_order_relaxed);
+		zones.push_back({ name, allocations, bytes, warmedUp ? allocations - _warmUpZoneAllocations[zone] : 0,
+			warmedUp ? bytes - _warmUpZoneBytes[zone] : 0 });
+	}
+	std::sort(zones.begin(), zones.end(), [](const ZoneTotal& a, const ZoneTotal& b)
+		{ return a._SteadyAllocations != b._SteadyAllocations ? a._SteadyAllocations > b._SteadyAllocations : a._Allocations > b._Allocations; });
+
+	report << "{\n"
+		<< "  \"frames\": " << _frames << ",\n"
+		<< "  \"ticks\": " << _ticks << ",\n"
+		<< "  \"warm_up_frames\": " << WARM_UP_FRAMES << ",\n"
+		<< "  \"frame_threshold\": " << _frameThreshold << ",\n"
+		<< "  \"steady_state\": {\"frames\": " << _steadyFrames << ", \"ticks\": " << _steadyTicks
+		<< ", \"allocations\": " << _steadyAllocations << ", \"bytes\": " << _steadyBytes
+		<< ", \"allocations_per_tick\": " << GetSteadyStateAllocationsPerTick() << ", \"bytes_per_tick\": " << bytesPerTick << "},\n"
+		<< "  \"worst_frame\": {\"frame\": " << _worstFrame._Frame << ", \"ticks\": " << _worstFrame._Ticks
+		<< ", \"allocations\": " << _worstFrame._Allocations << ", \"bytes\": " << _worstFrame._Bytes << "},\n"
+		<< "  \"flagged_frame_count\": " << _flaggedFrames << ",\n"
+		<< "  \"flagged_frames\": [";
+
+	for (int i = 0; i < std::min(_flaggedFrames, FLAGGED_FRAME_CAPACITY); i++)
+	{
+		const FlaggedFrame& frame = _flagged[i];
+		report << (i == 0 ? "\n" : ",\n")
+			<< "    {\"frame\": " << frame._Frame << ", \"ticks\": " << frame._Ticks
+			<< ", \"allocations\": " << frame._Allocations << ", \"bytes\": " << frame._Bytes << "}";
+	}
+
+	report << "\n  ],\n  \"zones\": [";
+	for (size_t i = 0; i < zones.size(); i++)
+	{
+		const ZoneTotal& zone = zones.at(i);
+		report << (i == 0 ? "\n" : ",\n")
+			<< "    {\"name\": \"" << zone._Name << "\""
+			<< ", \"allocations\": " << zone._Allocations
+			<< ", \"bytes\": " << zone._Bytes
+			<< ", \"steady_allocations\": " << zone._SteadyAllocations
+			<< ", \"steady_bytes\": " << zone._SteadyBytes << "}";
+	}
+	report << "\n  ]\n}\n";
+
+	return report.good();
+}
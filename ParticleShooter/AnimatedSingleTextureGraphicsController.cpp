@@ -1,4 +1,5 @@
 #include "AnimatedSingleTextureGraphicsController.h"
+#include "FrameArena.h"
 #include "GraphicAssetInfo.h"
 
 AnimatedSingleTextureGraphicsController::AnimatedSingleTextureGraphicsController(PropertyController* propertyController)
@@ -37,14 +38,17 @@ void AnimatedSingleTextureGraphicsController::Update()
 		the associated frames (textures) that should be displayed at the moment.
 
 	Returns:
-		An array of textures that should be rendered. If empty, no textures should be rendered
+		An array of textures that should be rendered, allocated from the FrameArena. If empty, no textures should be rendered
 */
-std::vector<std::shared_ptr<const Texture>> AnimatedSingleTextureGraphicsController::GetCurrentTextures() const
+Span<const Texture* const> AnimatedSingleTextureGraphicsController::GetCurrentTextures() const
 {
-	if (_animator->GetCurrentFrame() == nullptr)
+	const Texture* frame = _animator->GetCurrentFrame().get(); //The animation keeps the frame alive
+	if (frame == nullptr)
 		return {};
-	else
-		return { _animator->GetCurrentFrame() };
+
+	const Span<const Texture*> textures = FrameArena::GetInstance().AllocateArray<const Texture*>(1);
+	textures[0] = frame;
+	return textures;
 }
 
 void AnimatedSingleTextureGraphicsController::SetCurrentAnimation(std::shared_ptr<const Animation> animation)
@@ -55,4 +59,9 @@ void AnimatedSingleTextureGraphicsController::SetCurrentAnimation(std::shared_pt
 void AnimatedSingleTextureGraphicsController::SetAnimationFramePercent(const float& percent)
 {
 	_animator->SetAnimationFramePercent(percent);
+}
+
+void AnimatedSingleTextureGraphicsController::RestartAnimation()
+{
+	_animator->Restart();
 }
\ No newline at end of file
@@ -30,6 +30,7 @@ void Animation::AddFrame(const shared_ptr<Texture>& texture)
 void Animation::AddTransition(const Transition& transition)
 {
 	_transitions.push_back(transition);
+	CompileTransitions();
 }
 
 /*
@@ -44,6 +45,7 @@ void Animation::AddTransition(const Property& propertyId, const int& value, cons
 		if (ts.GetDestination() == destination)
 		{
 			ts.AddProperty(propertyId, value);
+			CompileTransitions();
 			return;
 		}
 	}
@@ -62,6 +64,36 @@ shared_ptr<Texture> Animation::GetCurrentFrame(int frameIndex) const
 	return _frames[frameIndex];
 }
 
+/*
+	Description:
+		Flattens _transitions into _compiledTransitions and _compiledConditions. Animation graphs are built
+		once per prototype, so this runs while the graph is being put together rather than during play.
+*/
+void Animation::CompileTransitions()
+{
+	_compiledTransitions.clear();
+	_compiledConditions.clear();
+
+	for (const Transition& transition : _transitions)
+	{
+		CompiledTransition compiled;
+		compiled._FirstCondition = static_cast<int>(_compiledConditions.size());
+
+		for (const std::pair<Property, int>& propertyValue : transition.GetPropertyValues())
+		{
+			CompiledCondition condition;
+			condition._Property = static_cast<int>(propertyValue.first);
+			condition._Value = propertyValue.second;
+
+			_compiledConditions.push_back(condition);
+			compiled._PropertyMask |= 1u << condition._Property;
+		}
+
+		compiled._ConditionCount = static_cast<int>(_compiledConditions.size()) - compiled._FirstCondition;
+		_compiledTransitions.push_back(compiled);
+	}
+}
+
 /*
 	Description:
 		Checks if any of the transition's property expectations have been matched. If so, return that transition's
@@ -73,21 +105,24 @@ shared_ptr<Texture> Animation::GetCurrentFrame(int frameIndex) const
 */
 shared_ptr<const Animation> Animation::GetNextAnimation(const int& frameIndex, const PropertyController* propertyController) const
 {
-	for (const auto& transition : _transitions)
+	if (!CanTransition(frameIndex))
+		return nullptr;
+
+	const std::uint32_t assigned = propertyController->GetAssignedMask();
+	const std::array<int, PROPERTY_COUNT>& values = propertyController->GetValues();
+
+	for (size_t i = 0; i < _compiledTransitions.size(); i++)
 	{
-		if (!_looping)
-		{
-			//Non-looping animations don't transition until all of their frame's have executed 
-			const bool shouldTransition = transition.ShouldTransition(*propertyController) && frameIndex >= _frames.size() - 1;
-			if (shouldTransition)
-				return transition.GetDestination();
-		}
-		else if (_looping)
-		{
-			const bool shouldTransition = transition.ShouldTransition(*propertyController);
-			if (shouldTransition)
-				return transition.GetDestination();
-		}
+		const CompiledTransition& transition = _compiledTransitions[i];
+		if ((assigned & transition._PropertyMask) != transition._PropertyMask)
+			PropertyController::ReportUnassigned();
+
+		bool matched = true;
+		for (int condition = transition._FirstCondition; condition < transition._FirstCondition + transition._ConditionCount && matched; condition++)
+			matched = values[_compiledConditions[condition]._Property] == _compiledConditions[condition]._Value;
+
+		if (matched)
+			return _transitions[i].GetDestination();
 	}
 	return nullptr;
 }
\ No newline at end of file
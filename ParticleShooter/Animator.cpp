@@ -24,6 +24,7 @@ void Animator::SetCurrentAnimation(const std::shared_ptr<const Animation>& anima
 
 	_currentAnim = animation;
 	_frameIndex = 0;
+	_transitionsChecked = false;
 	Play();
 }
 
@@ -42,6 +43,16 @@ void Animator::Stop() const
 	_clock.Stop();
 }
 
+/*
+	Description:
+		Plays the starting animation again from its first frame, as if the animator had just been copied.
+*/
+void Animator::Restart()
+{
+	Stop();
+	SetCurrentAnimation(_startingAnim);
+}
+
 /*
 	Description:
 		Called whenever the graphics on an object should be progressed forward (typically every frame).
@@ -64,9 +75,25 @@ void Animator::Update()
 	Description:
 		Asks the current animation if it is ready to transition to the next.
 		If so, transitions by stopping the old and starting the new.
+
+		Transitions are only re-evaluated when the properties change or a non-looping animation reaches
+		its final frame, so an animation sitting in a steady state costs a version comparison per frame.
 */
 void Animator::TransitionToNextAnimationIfNeeded()
 {
+	if (!_currentAnim->CanTransition(_frameIndex))
+	{
+		_transitionsChecked = false; //Checked again as soon as the final frame is reached
+		return;
+	}
+
+	const std::uint32_t version = _propertyController->GetVersion();
+	if (_transitionsChecked && _checkedVersion == version)
+		return;
+
+	_transitionsChecked = true;
+	_checkedVersion = version;
+
 	const shared_ptr<const Animation> nextAnim = _currentAnim->GetNextAnimation(_frameIndex, _propertyController);
 	if (nextAnim != nullptr)
 	{
@@ -84,7 +111,7 @@ void Animator::UpdateCurrentFrameBasedOnCurrentTime() const
 {
 	if (_playing)
 	{
-		const bool FrameTimeHasElapsed = _clock.GetMilliseconds() >= _timePerFrame / _currentAnim->GetAnimationSpeed();
+		const bool FrameTimeHasElapsed = _clock.GetMilliseconds() >= TIME_PER_FRAME / _currentAnim->GetAnimationSpeed();
 		if (FrameTimeHasElapsed)
 		{
 			/* Progress to the next frame */
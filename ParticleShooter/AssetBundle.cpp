@@ -0,0 +1,294 @@
+#include "AssetBundle.h"
+#include "ErrorHandler.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <SDL_image.h>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+	const char BUNDLE_MAGIC[4] = { 'P', 'S', 'A', 'B' };
+	const uint32_t BUNDLE_VERSION = 1;
+	const uint32_t BUNDLE_PIXEL_FORMAT = SDL_PIXELFORMAT_ARGB8888; //Native format of the accelerated renderers. Textures upload without conversion
+	const uint64_t BUNDLE_ALIGNMENT = 16; //Every image's pixels start on this byte boundary
+	const uint32_t COLOR_KEY = 0x0000FFFF; //Cyan in ARGB8888. Matches the color key applied by Renderer::CreateTextureFromFile
+
+	static_assert(sizeof(AssetBundle::Image) == 136, "The bundle index layout on disk must not change without bumping BUNDLE_VERSION");
+
+	uint64_t AlignOffset(const uint64_t offset)
+	{
+		return (offset + BUNDLE_ALIGNMENT - 1) & ~(BUNDLE_ALIGNMENT - 1);
+	}
+
+	void WritePadding(std::ofstream& bundle, const uint64_t currentOffset, const uint64_t alignedOffset)
+	{
+		static const char zeros[BUNDLE_ALIGNMENT] = {};
+		bundle.write(zeros, static_cast<std::streamsize>(alignedOffset - currentOffset));
+	}
+}
+
+AssetBundle::~AssetBundle()
+{
+	Close();
+}
+
+AssetBundle& AssetBundle::GetInstance()
+{
+	static AssetBundle bundle;
+	return bundle;
+}
+
+/*
+	Description:
+		Memory maps the bundle at bundlePath and validates its header. A missing bundle is not an error, Textures
+		simply keep loading from the loose pngs.
+
+	Arguments:
+		bundlePath - Path of a bundle previously written by AssetBundle::Build
+
+	Return:
+		bool - Whether or not the bundle is open and can be used for lookups
+*/
+bool AssetBundle::Open(const std::string& bundlePath)
+{
+	ProfileZone zone("Load/AssetBundle");
+	Close();
+
+	if (!MapFile(bundlePath))
+		return false;
+
+	_header = reinterpret_cast<const Header*>(_mappedData);
+	_images = reinterpret_cast<const Image*>(_mappedData + sizeof(Header));
+
+	const bool validHeader = _mappedSize >= sizeof(Header) && std::memcmp(_header->_Magic, BUNDLE_MAGIC, sizeof(BUNDLE_MAGIC)) == 0 && _header->_Version == BUNDLE_VERSION;
+	const bool validIndex = validHeader && _mappedSize >= sizeof(Header) + sizeof(Image) * static_cast<size_t>(_header->_ImageCount);
+
+	ErrorHandler::Assert(validIndex, "Asset bundle is corrupt or out of date: " + bundlePath + ". Rebuild it with --bundle-assets");
+	if (!validIndex)
+		Close();
+
+	return IsOpen();
+}
+
+void AssetBundle::Close()
+{
+	UnmapFile();
+	_header = nullptr;
+	_images = nullptr;
+}
+
+/*
+	Description:
+		Binary searches the mapped index for the image that was bundled from filePath
+
+	Arguments:
+		filePath - The path of the original png. Identical to the path used to load it as a loose file
+
+	Return:
+		const Image* - The bundled image or nullptr if the bundle is closed or doesn't contain the file
+*/
+const AssetBundle::Image* AssetBundle::FindImage(const std::string& filePath) const
+{
+	if (!IsOpen())
+		return nullptr;
+
+	const Image* indexEnd = _images + _header->_ImageCount;
+	const Image* image = std::lower_bound(_images, indexEnd, filePath, [](const Image& entry, const std::string& path)
+		{ return path.compare(entry._FilePath) > 0; });
+
+	if (image != indexEnd && filePath.compare(image->_FilePath) == 0)
+		return image;
+
+	return nullptr;
+}
+
+uint32_t AssetBundle::GetPixelFormat() const
+{
+	return IsOpen() ? _header->_PixelFormat : 0;
+}
+
+/*
+	Description:
+		Offline bundler. Decodes every png under assetDirectory, converts it to BUNDLE_PIXEL_FORMAT, bakes the cyan
+		color key into the alpha channel and writes the results into a single indexed file.
+
+		File layout: Header | Image index sorted by path | 16 byte aligned pixel rows for each image
+
+	Arguments:
+		assetDirectory - Root directory to search for pngs. Bundled paths are stored relative to the working directory
+		bundlePath - Where to write the bundle. Overwritten if it already exists
+
+	Return:
+		bool - Whether or not every png was bundled successfully
+*/
+bool AssetBundle::Build(const std::string& assetDirectory, const std::string& bundlePath)
+{
+	std::vector<std::string> filePaths;
+	for (const std::filesystem::directory_entry& entry : std::filesystem::recursive_directory_iterator(assetDirectory))
+	{
+		if (entry.is_regular_file() && entry.path().extension() == ".png")
+			filePaths.push_back(entry.path().generic_string());
+	}
+	std::sort(filePaths.begin(), filePaths.end()); //FindImage binary searches the index
+
+	std::ofstream bundle(bundlePath, std::ios::binary | std::ios::trunc);
+	if (!bundle)
+		return false;
+
+	Header header;
+	std::memcpy(header._Magic, BUNDLE_MAGIC, sizeof(BUNDLE_MAGIC));
+	header._Version = BUNDLE_VERSION;
+	header._ImageCount = static_cast<uint32_t>(filePaths.size());
+	header._PixelFormat = BUNDLE_PIXEL_FORMAT;
+
+	//The index is only complete once every image is written. Reserve its space up front and patch it in at the end
+	std::vector<Image> images(filePaths.size());
+	const uint64_t indexSize = sizeof(Header) + sizeof(Image) * images.size();
+	uint64_t pixelOffset = AlignOffset(indexSize);
+	bundle.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+	bundle.write(reinterpret_cast<const char*>(images.data()), sizeof(Image) * images.size());
+	WritePadding(bundle, indexSize, pixelOffset);
+
+	for (size_t i = 0; i < filePaths.size(); i++)
+	{
+		const std::string& filePath = filePaths.at(i);
+		ErrorHandler::Assert(filePath.size() < sizeof(Image::_FilePath), "Asset path is too long to bundle: " + filePath);
+
+		SDL_Surface* loadedSurface = IMG_Load(filePath.c_str());
+		ErrorHandler::Assert(loadedSurface != nullptr, "Unable to load image from: " + filePath + ". SDL_image Error: " + IMG_GetError());
+		if (loadedSurface == nullptr || filePath.size() >= sizeof(Image::_FilePath))
+			return false;
+
+		SDL_Surface* nativeSurface = SDL_ConvertSurfaceFormat(loadedSurface, BUNDLE_PIXEL_FORMAT, 0);
+		SDL_FreeSurface(loadedSurface);
+		if (nativeSurface == nullptr)
+			return false;
+
+		Image& image = images.at(i);
+		std::memset(image._FilePath, 0, sizeof(image._FilePath));
+		std::memcpy(image._FilePath, filePath.c_str(), filePath.size());
+		image._Width = nativeSurface->w;
+		image._Height = nativeSurface->h;
+		image._Pitch = nativeSurface->w * sizeof(uint32_t);
+		image._PixelOffset = pixelOffset;
+
+		std::vector<uint32_t> row(nativeSurface->w);
+		for (int y = 0; y < nativeSurface->h; y++)
+		{
+			std::memcpy(row.data(), static_cast<const uint8_t*>(nativeSurface->pixels) + y * nativeSurface->pitch, image._Pitch);
+			for (uint32_t& pixel : row)
+			{
+				if ((pixel & 0x00FFFFFF) == COLOR_KEY)
+					pixel = 0; //Fully transparent, exactly what SDL produces for color keyed pixels
+			}
+			bundle.write(reinterpret_cast<const char*>(row.data()), image._Pitch);
+		}
+
+		SDL_FreeSurface(nativeSurface);
+
+		const uint64_t imageEnd = pixelOffset + static_cast<uint64_t>(image._Pitch) * image._Height;
+		pixelOffset = AlignOffset(imageEnd);
+		WritePadding(bundle, imageEnd, pixelOffset);
+	}
+
+	bundle.seekp(sizeof(Header));
+	bundle.write(reinterpret_cast<const char*>(images.data()), sizeof(Image) * images.size());
+
+	return bundle.good();
+}
+
+#ifdef _WIN32
+
+bool AssetBundle::MapFile(const std::string& bundlePath)
+{
+	HANDLE file = CreateFileA(bundlePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER fileSize;
+	HANDLE fileMapping = GetFileSizeEx(file, &fileSize) ? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+	const void* mappedData = fileMapping != nullptr ? MapViewOfFile(fileMapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+	if (mappedData == nullptr)
+	{
+		if (fileMapping != nullptr)
+			CloseHandle(fileMapping);
+		CloseHandle(file);
+		return false;
+	}
+
+	_fileHandle = file;
+	_fileMappingHandle = fileMapping;
+	_mappedData = static_cast<const uint8_t*>(mappedData);
+	_mappedSize = static_cast<size_t>(fileSize.QuadPart);
+	return true;
+}
+
+void AssetBundle::UnmapFile()
+{
+	if (_mappedData != nullptr)
+		UnmapViewOfFile(_mappedData);
+	if (_fileMappingHandle != nullptr)
+		CloseHandle(_fileMappingHandle);
+	if (_fileHandle != nullptr)
+		CloseHandle(_fileHandle);
+
+	_mappedData = nullptr;
+	_mappedSize = 0;
+	_fileMappingHandle = nullptr;
+	_fileHandle = nullptr;
+}
+
+#else
+
+bool AssetBundle::MapFile(const std::string& bundlePath)
+{
+	const int fileDescriptor = open(bundlePath.c_str(), O_RDONLY);
+	if (fileDescriptor < 0)
+		return false;
+
+	struct stat fileInfo;
+	void* mappedData = MAP_FAILED;
+	if (fstat(fileDescriptor, &fileInfo) == 0 && fileInfo.st_size > 0)
+		mappedData = mmap(nullptr, static_cast<size_t>(fileInfo.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+	if (mappedData == MAP_FAILED)
+	{
+		close(fileDescriptor);
+		return false;
+	}
+
+	_fileDescriptor = fileDescriptor;
+	_mappedData = static_cast<const uint8_t*>(mappedData);
+	_mappedSize = static_cast<size_t>(fileInfo.st_size);
+	return true;
+}
+
+void AssetBundle::UnmapFile()
+{
+	if (_mappedData != nullptr)
+		munmap(const_cast<uint8_t*>(_mappedData), _mappedSize);
+	if (_fileDescriptor >= 0)
+		close(_fileDescriptor);
+
+	_mappedData = nullptr;
+	_mappedSize = 0;
+	_fileDescriptor = -1;
+}
+
+#endif
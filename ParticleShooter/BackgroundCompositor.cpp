@@ -0,0 +1,187 @@
+#include "AssetBundle.h"
+#include "BackgroundCompositor.h"
+#include "ErrorHandler.h"
+#include "MultiTextureGraphicsController.h"
+#include "Profiler.h"
+#include "Texture.h"
+
+#include <algorithm>
+#include <SDL_image.h>
+
+BackgroundCompositor::BackgroundCompositor(const int& tileSize) : _tileSize(tileSize)
+{
+	ErrorHandler::Assert(tileSize > 0, "Background tiles need a positive size");
+}
+
+/*
+	Description:
+		Queues a png to be composited. Layers are drawn in the order they are added.
+
+	Arguments:
+		filePath - where the png is located
+		xOffset - The horizontal offset from the background's origin (Top Left)
+		yOffset - The vertical offset from the background's origin (Top Left)
+		parallax - Relative speed at which to follow along with the camera scrolling. 1.0 follows along at the same speed
+*/
+void BackgroundCompositor::AddLayer(const std::string& filePath, const int& xOffset, const int& yOffset, const float& parallax)
+{
+	Layer layer;
+	layer._FilePath = filePath;
+	layer._Bounds = { xOffset, yOffset, 0, 0 };
+	layer._Parallax = parallax;
+	_layers.push_back(layer);
+}
+
+/*
+	Description:
+		Blends every run of consecutive layers sharing a parallax factor into tiles and adds the tiles to the graphics controller.
+
+	Arguments:
+		graphicsController - Receives the tile textures, back to front
+*/
+void BackgroundCompositor::Composite(MultiTextureGraphicsController& graphicsController) const
+{
+	ProfileZone zone("Load/Background");
+
+	size_t first = 0;
+	while (first < _layers.size())
+	{
+		size_t last = first + 1;
+		while (last < _layers.size() && _layers.at(last)._Parallax == _layers.at(first)._Parallax)
+			last++;
+
+		CompositeGroup(first, last, graphicsController);
+		first = last;
+	}
+}
+
+/*
+	Description:
+		Composites the layers in [first, last) into tiles covering their combined bounds. Tiles that end up fully
+		transparent are dropped.
+
+	Arguments:
+		first - Index of the first layer in the group
+		last - One past the index of the last layer in the group
+		graphicsController - Receives the tile textures
+*/
+void BackgroundCompositor::CompositeGroup(const size_t& first, const size_t& last, MultiTextureGraphicsController& graphicsController) const
+{
+	std::vector<SDL_Surface*> surfaces;
+	std::vector<SDL_Rect> bounds;
+	SDL_Rect groupBounds = { 0, 0, 0, 0 };
+
+	for (size_t i = first; i < last; i++)
+	{
+		SDL_Surface* surface = LoadSurface(_layers.at(i)._FilePath);
+		if (surface == nullptr)
+			continue;
+
+		SDL_Rect layerBounds = _layers.at(i)._Bounds;
+		layerBounds.w = surface->w;
+		layerBounds.h = surface->h;
+
+		if (surfaces.empty())
+			groupBounds = layerBounds;
+		else
+		{
+			const int right = std::max(groupBounds.x + groupBounds.w, layerBounds.x + layerBounds.w);
+			const int bottom = std::max(groupBounds.y + groupBounds.h, layerBounds.y + layerBounds.h);
+			groupBounds.x = std::min(groupBounds.x, layerBounds.x);
+			groupBounds.y = std::min(groupBounds.y, layerBounds.y);
+			groupBounds.w = right - groupBounds.x;
+			groupBounds.h = bottom - groupBounds.y;
+		}
+
+		surfaces.push_back(surface);
+		bounds.push_back(layerBounds);
+	}
+
+	const float parallax = _layers.at(first)._Parallax;
+	for (int y = groupBounds.y; y < groupBounds.y + groupBounds.h; y += _tileSize)
+	{
+		for (int x = groupBounds.x; x < groupBounds.x + groupBounds.w; x += _tileSize)
+		{
+			const SDL_Rect tileBounds = { x, y, std::min(_tileSize, groupBounds.x + groupBounds.w - x), std::min(_tileSize, groupBounds.y + groupBounds.h - y) };
+			SDL_Surface* tile = SDL_CreateRGBSurfaceWithFormat(0, tileBounds.w, tileBounds.h, 32, SDL_PIXELFORMAT_ARGB8888);
+			ErrorHandler::Assert(tile != nullptr, "Unable to create a background tile. SDL Error: " + std::string(SDL_GetError()));
+			if (tile == nullptr)
+				continue;
+
+			SDL_FillRect(tile, nullptr, 0); //Fully transparent
+			for (size_t i = 0; i < surfaces.size(); i++)
+			{
+				SDL_Rect overlap;
+				if (!SDL_IntersectRect(&bounds.at(i), &tileBounds, &overlap))
+					continue;
+
+				SDL_Rect source = { overlap.x - bounds.at(i).x, overlap.y - bounds.at(i).y, overlap.w, overlap.h };
+				SDL_Rect destination = { overlap.x - tileBounds.x, overlap.y - tileBounds.y, overlap.w, overlap.h };
+				SDL_BlitSurface(surfaces.at(i), &source, tile, &destination);
+			}
+
+			//Layers rarely cover their whole bounding box. Empty tiles would only cost a draw call
+			bool visible = false;
+			for (int row = 0; row < tile->h && !visible; row++)
+			{
+				const Uint32* pixels = reinterpret_cast<const Uint32*>(static_cast<const Uint8*>(tile->pixels) + row * tile->pitch);
+				visible = std::any_of(pixels, pixels + tile->w, [](const Uint32 pixel) { return (pixel & 0xFF000000) != 0; });
+			}
+
+			if (visible)
+			{
+				const std::shared_ptr<Texture> texture = std::make_shared<Texture>(tile->pixels, tile->w, tile->h, tile->pitch, SDL_PIXELFORMAT_ARGB8888);
+				texture->SetOffset(tileBounds.x, tileBounds.y);
+				texture->SetParallax(parallax);
+				graphicsController.AddTexture(texture);
+			}
+
+			SDL_FreeSurface(tile);
+		}
+	}
+
+	for (SDL_Surface* surface : surfaces)
+		SDL_FreeSurface(surface);
+}
+
+/*
+	Description:
+		Loads a png as an ARGB8888 surface that blends onto the tiles. Bundled pixels already have the cyan
+		color key baked into their alpha channel, loose pngs are keyed the same way Renderer::CreateTextureFromFile does.
+
+	Arguments:
+		filePath - where the png is located
+
+	Return:
+		SDL_Surface* - The decoded surface. Owned by the caller. nullptr if the png couldn't be loaded
+*/
+SDL_Surface* BackgroundCompositor::LoadSurface(const std::string& filePath)
+{
+	const AssetBundle& bundle = AssetBundle::GetInstance();
+	const AssetBundle::Image* bundledImage = bundle.FindImage(filePath);
+
+	SDL_Surface* surface = nullptr;
+	if (bundledImage != nullptr)
+	{
+		//Only ever read from, so the mapped pixels can be used without a copy
+		void* pixels = const_cast<void*>(bundle.GetPixels(*bundledImage));
+		surface = SDL_CreateRGBSurfaceWithFormatFrom(pixels, bundledImage->_Width, bundledImage->_Height, 32, bundledImage->_Pitch, bundle.GetPixelFormat());
+	}
+	else
+	{
+		SDL_Surface* loadedSurface = IMG_Load(filePath.c_str());
+		ErrorHandler::Assert(loadedSurface != nullptr, "Unable to load image from: " + filePath + ". SDL_image Error: " + IMG_GetError());
+		if (loadedSurface == nullptr)
+			return nullptr;
+
+		surface = SDL_ConvertSurfaceFormat(loadedSurface, SDL_PIXELFORMAT_ARGB8888, 0);
+		SDL_FreeSurface(loadedSurface);
+		if (surface != nullptr)
+			SDL_SetColorKey(surface, SDL_TRUE, SDL_MapRGB(surface->format, 0, 0xFF, 0xFF));
+	}
+
+	if (surface != nullptr)
+		SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_BLEND);
+
+	return surface;
+}
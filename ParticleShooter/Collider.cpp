@@ -5,22 +5,18 @@ using std::vector;
 
 Collider::Collider()
 {
-	//By default, Colliders don't ignore any other Collider type
-	for(int i = 0; i < ColliderType::ALL; i++)
-		_ignoreTypes[i] = false;
-
 	_Baton._Type = ColliderType::ENVIRONMENT;
 }
 
 /*
 	Description:
-		Checks the _ignoreTypes array to see if a specific ColliderType is being ignored.
+		Checks the _ignoreTypes bits to see if a specific ColliderType is being ignored.
 		Used to determine if the CollisionManager should skip over a collision test
 */
 bool Collider::IsIgnoring(ColliderType type) const
 {
 	const int index = static_cast<int>(type);
-	return _ignoreTypes[index];
+	return (_ignoreTypes & (1u << index)) != 0;
 }
 
 /*
@@ -52,7 +48,7 @@ void Collider::SetColliderIgnoreTypes(std::vector<ColliderType> ignoreTypes)
 	for (int i = 0; i < ignoreTypes.size(); i++)
 	{
 		int index = static_cast<int>(ignoreTypes.at(i));
-		_ignoreTypes[index] = true;
+		_ignoreTypes |= 1u << index;
 	}
 }
 
@@ -1,11 +1,14 @@
 #include "CollisionManager.h"
 #include "CollisionResponse.h"
 #include "ColliderInterface.h"
+#include "FrameArena.h"
 #include "RigidBody.h"
 #include "SeparatingAxisCollision.h"
+#include "Stats.h"
 #include "Vector2.h"
 
 #include <algorithm>
+#include <functional>
 
 using std::vector;
 using std::shared_ptr;
@@ -18,6 +21,9 @@ using std::shared_ptr;
 */
 void CollisionManager::SimulateCurrentCollisions() const
 {
+	Stats& stats = Stats::GetInstance();
+	stats.Set(StatCounter::COLLIDERS, static_cast<int>(_colliders.size()));
+
 	for (int current = 0; current < _colliders.size(); current++)
 	{
 		ColliderInterface* currentCollider = _colliders.at(current);
@@ -33,10 +39,12 @@ void CollisionManager::SimulateCurrentCollisions() const
 			const bool shouldTestForCollision = ShouldTestForCollision(currentCollider, otherCollider);
 			if (shouldTestForCollision)
 			{
+				stats.Increment(StatCounter::BROADPHASE_PAIRS);
 				const bool IsColliding = SeparatingAxisCollision::IsColliding(currentCollider, otherCollider);
 
 				if (IsColliding)
 				{
+					stats.Increment(StatCounter::COLLISIONS);
 					const Vector2 collisionPoint = SeparatingAxisCollision::CalculateCollisionPoint(currentCollider, otherCollider);
 					HandleCollisionResponse(currentCollider, otherCollider, collisionPoint);
 					HandleCollisionResponse(otherCollider, currentCollider, collisionPoint);
@@ -134,12 +142,52 @@ void CollisionManager::AddCollider(ColliderInterface* collider)
 	}
 }
 
-void CollisionManager::AddCollider(const std::vector<ColliderInterface*>& colliders)
+/*
+	Description:
+		Adds a batch of colliders in a single pass over _colliders. Colliders that are already registered,
+		or repeated within the batch, are only added once.
+
+	Arguments
+		colliders - Appended in order
+*/
+void CollisionManager::AddCollider(const Span<ColliderInterface* const>& colliders)
 {
-	for (auto& interface : colliders)
-		AddCollider(interface);
-}
+	if (colliders.empty())
+		return;
+
+	FrameArena& arena = FrameArena::GetInstance();
+	FrameArena::Scope scope(arena);
 
+	//Sorted so that membership is a binary search. added[i] is set once sorted[i] is known to be registered
+	const Span<ColliderInterface*> sorted = arena.AllocateArray<ColliderInterface*>(colliders.size());
+	std::copy(colliders.begin(), colliders.end(), sorted.begin());
+	std::sort(sorted.begin(), sorted.end(), std::less<ColliderInterface*>());
+
+	const Span<bool> added = arena.AllocateArray<bool>(sorted.size());
+	std::fill(added.begin(), added.end(), false);
+
+	const auto find = [&sorted](ColliderInterface* collider) -> ColliderInterface** {
+		ColliderInterface** found = std::lower_bound(sorted.begin(), sorted.end(), collider, std::less<ColliderInterface*>());
+		return (found != sorted.end() && *found == collider) ? found : nullptr;
+	};
+
+	for (ColliderInterface* registered : _colliders)
+	{
+		ColliderInterface** found = find(registered);
+		if (found != nullptr)
+			added[found - sorted.begin()] = true;
+	}
+
+	for (ColliderInterface* collider : colliders)
+	{
+		bool& alreadyAdded = added[find(collider) - sorted.begin()];
+		if (!alreadyAdded)
+		{
+			_colliders.push_back(collider);
+			alreadyAdded = true;
+		}
+	}
+}
 
 void CollisionManager::RemoveCollider(ColliderInterface* collider)
 {
@@ -152,6 +200,29 @@ void CollisionManager::RemoveCollider(ColliderInterface* collider)
 	}
 }
 
+/*
+	Description:
+		Removes a batch of colliders with a single compaction of _colliders. The remaining colliders keep their order.
+
+	Arguments
+		colliders - Colliders to stop considering. Ones that aren't registered are ignored
+*/
+void CollisionManager::RemoveColliders(const Span<ColliderInterface* const>& colliders)
+{
+	if (colliders.empty())
+		return;
+
+	FrameArena& arena = FrameArena::GetInstance();
+	FrameArena::Scope scope(arena);
+
+	const Span<ColliderInterface*> removed = arena.AllocateArray<ColliderInterface*>(colliders.size());
+	std::copy(colliders.begin(), colliders.end(), removed.begin());
+	std::sort(removed.begin(), removed.end(), std::less<ColliderInterface*>());
+
+	_colliders.erase(std::remove_if(_colliders.begin(), _colliders.end(), [&removed](ColliderInterface* collider)
+		{ return std::binary_search(removed.begin(), removed.end(), collider, std::less<ColliderInterface*>()); }), _colliders.end());
+}
+
 CollisionManager::~CollisionManager()
 {
 	_colliders.clear();
@@ -1,6 +1,8 @@
 #include "CollisionResponse.h"
 #include "RigidBody.h"
 
+#include <cmath>
+
 double CollisionResponse::_ignoreResponseAngle = 90;
 
 /*
@@ -16,7 +18,7 @@ double CollisionResponse::_ignoreResponseAngle = 90;
 		Vector2 - The suggested impulse velocity that should be applied to the currentRigidBody as a result to its collision
 */
 
-Vector2 CollisionResponse::CalculateResultingImpulseVelocity(const RigidBody& const currentRigidBody, const RigidBody& const otherRigidBody, const Vector2 collisionNormal)
+Vector2 CollisionResponse::CalculateResultingImpulseVelocity(const RigidBody& currentRigidBody, const RigidBody& otherRigidBody, const Vector2 collisionNormal)
 {
 	const double collisionAngle = currentRigidBody.GetVelocity().AngleBetween(collisionNormal);
 	if (abs(collisionAngle) >= _ignoreResponseAngle)
@@ -1,4 +1,5 @@
 #include "Common.h"
+#include "Random.h"
 #include "Vector2.h"
 
 #include <cmath>
@@ -16,13 +17,18 @@ bool CommonHelpers::AreEqual(Vector2 a, Vector2 b, const double acceptableDiffer
 
 Vector2 CommonHelpers::RandomOffset(int offsetMagnitude)
 {
-	int newX = rand() % offsetMagnitude;
-	int newY = rand() % offsetMagnitude;
+	return RandomOffset(offsetMagnitude, Random::GetWorldInstance());
+}
+
+Vector2 CommonHelpers::RandomOffset(int offsetMagnitude, Random& random)
+{
+	int newX = random.Range(offsetMagnitude);
+	int newY = random.Range(offsetMagnitude);
 
-	if (rand() % 10 >= 5)
+	if (random.Range(10) >= 5)
 		newX *= -1;
 
-	if (rand() % 10 >= 5)
+	if (random.Range(10) >= 5)
 		newY *= -1;
 
 	return Vector2(newX, newY);
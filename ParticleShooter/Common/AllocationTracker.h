@@ -0,0 +1,115 @@
+//
+//  AllocationTracker.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/*
+	Opt in breakdown of the game's heap allocations. While enabled, the global operator new in AllocationTracker.cpp
+	charges every allocation's count and size to the current frame and to the innermost ProfileZone open on the
+	allocating thread, whether or not the Profiler itself is recording.
+
+	main closes out each frame with EndFrame. Frames after the warm up that allocate more than the threshold are
+	flagged, and WriteReport summarizes the steady state allocations per tick and each zone's share on quit.
+
+	Recording is a few relaxed atomic adds and never allocates itself. Zones are told apart by their name's pointer,
+	which is why ProfileZone names must be string literals.
+*/
+class AllocationTracker final
+{
+public:
+	static AllocationTracker& GetInstance()
+	{
+		static AllocationTracker tracker;
+		return tracker;
+	}
+
+	static void RecordAllocation(const size_t& bytes);
+
+	//Called by ProfileZone. Returns the zone that was open before, to be handed back to LeaveZone
+	static const char* EnterZone(const char* name)
+	{
+		const char* parent = CURRENT_ZONE;
+		CURRENT_ZONE = name;
+		return parent;
+	}
+	static void LeaveZone(const char* parent) { CURRENT_ZONE = parent; }
+
+	void EndFrame(const int ticks);
+	bool WriteReport(const std::string& filePath) const;
+
+	/* Getters */
+	bool IsEnabled() const { return ENABLED.load(std::memory_order_relaxed); }
+	std::uint64_t GetLastFrameAllocations() const { return _lastFrameAllocations; }
+	std::uint64_t GetLastFrameBytes() const { return _lastFrameBytes; }
+	int GetFlaggedFrames() const { return _flaggedFrames; }
+	double GetSteadyStateAllocationsPerTick() const;
+
+	/* Setters */
+	void SetEnabled(const bool enabled) { ENABLED.store(enabled, std::memory_order_relaxed); }
+	void SetFrameThreshold(const int allocations) { _frameThreshold = allocations; } //Steady state frames allocating more than this are flagged
+
+	static const int WARM_UP_FRAMES = 120; //Level loading and first spawns. Excluded from the steady state
+
+private:
+	AllocationTracker() {}
+	AllocationTracker(const AllocationTracker&);
+	AllocationTracker& operator=(const AllocationTracker&);
+
+	//Running totals for one zone. A slot is claimed the first time its zone allocates and is never released
+	struct ZoneSlot
+	{
+		std::atomic<const char*> _Name;
+		std::atomic<std::uint64_t> _Allocations;
+		std::atomic<std::uint64_t> _Bytes;
+	};
+
+	//A frame that went over the threshold
+	struct FlaggedFrame
+	{
+		int _Frame = 0;
+		int _Ticks = 0;
+		std::uint64_t _Allocations = 0;
+		std::uint64_t _Bytes = 0;
+	};
+
+	static ZoneSlot& FindZone(const char* name);
+
+	static const int ZONE_CAPACITY = 256; //Open addressed by name pointer. Zones past this are charged to OVERFLOW_ZONE
+	static const int FLAGGED_FRAME_CAPACITY = 64; //Flagged frames kept for the report. Later ones are only counted
+	static const char* const OUTSIDE_ZONES; //Charged when no ProfileZone is open
+	static const char* const OVERFLOW_ZONE;
+
+	static std::atomic<bool> ENABLED;
+	static thread_local const char* CURRENT_ZONE;
+	static ZoneSlot ZONES[ZONE_CAPACITY];
+	static std::atomic<std::uint64_t> FRAME_ALLOCATIONS; //Since the last EndFrame
+	static std::atomic<std::uint64_t> FRAME_BYTES;
+
+	int _frameThreshold = 0;
+	int _frames = 0; //Frames ended since launch
+	int _ticks = 0;
+	std::uint64_t _lastFrameAllocations = 0;
+	std::uint64_t _lastFrameBytes = 0;
+
+	int _steadyFrames = 0;
+	int _steadyTicks = 0;
+	std::uint64_t _steadyAllocations = 0;
+	std::uint64_t _steadyBytes = 0;
+	FlaggedFrame _worstFrame;
+
+	int _flaggedFrames = 0;
+	FlaggedFrame _flagged[FLAGGED_FRAME_CAPACITY]; //Fixed so flagging never allocates
+
+	std::uint64_t _warmUpZoneAllocations[ZONE_CAPACITY] = {}; //Each zone's totals when the warm up ended, so the steady state can be separated out
+	std::uint64_t _warmUpZoneBytes[ZONE_CAPACITY] = {};
+};
@@ -8,6 +8,7 @@
 
 #pragma once
 
+class Random;
 struct Vector2;
 
 const int SCREEN_WIDTH = 1920;
@@ -19,6 +20,8 @@ enum Movement { FORWARD, BACKWARDS, RIGHT_SIDE, LEFT_SIDE };
 enum Direction { UP, DOWN, LEFT, RIGHT };
 enum ColliderType { ENVIRONMENT, ENEMY, ENEMYATTACK, PLAYER, PLAYERATTACK, PICKUP, ALL };
 enum class RenderingLayer { UI = 0, PARTICLES, PLAYER, ENEMIES, ITEMS, GENERAL, LEVEL };
+const int RENDERING_LAYER_COUNT = static_cast<int>(RenderingLayer::LEVEL) + 1;
+enum class RenderingBackend { ACCELERATED = 0, SOFTWARE, NONE }; //NONE keeps Texture metadata but never creates a window or draws pixels
 
 //Identification for game objects. Useful for when collision response is unique to a specific object
 enum class ObjectId
@@ -49,6 +52,7 @@ struct CommonHelpers
 
 	static bool AreEqual(Vector2 a, Vector2 b, const double acceptableDifference = 0.01);
 
-	static Vector2 RandomOffset(int offsetMagnitude);
+	static Vector2 RandomOffset(int offsetMagnitude); //Draws from the world's Random
+	static Vector2 RandomOffset(int offsetMagnitude, Random& random);
 };
 
@@ -0,0 +1,139 @@
+//
+//  FrameArena.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include "Span.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <vector>
+
+/*
+	Bump allocator for data that only lives until the end of the current Update or Render. Allocating moves an offset
+	through one block and freeing does nothing. GameManager rewinds the whole arena with Reset at the top of every Update
+	and Render, so anything allocated from it must not be kept past the phase it was allocated in.
+
+	Use AllocateArray for plain arrays, or pass the arena to std::pmr containers as their memory resource.
+	Scopes rewind the arena early for code that runs many times per phase, or outside the game loop altogether
+	(the unit tests and benchmarks never Reset).
+
+	When a phase needs more than the block holds, the rest comes from the heap and the block is grown to fit on the
+	next Reset. After a few frames a steady state phase never touches the heap. Main thread only.
+*/
+class FrameArena final : public std::pmr::memory_resource
+{
+public:
+	static FrameArena& GetInstance()
+	{
+		static FrameArena arena;
+		return arena;
+	}
+
+	//Everything allocated while a Scope is alive is released when it ends
+	class Scope final
+	{
+	public:
+		Scope(FrameArena& arena = FrameArena::GetInstance()) : _arena(arena), _offset(arena._offset), _overflowBlocks(arena._overflow.size()), _overflowBytes(arena._overflowBytes) {}
+		~Scope() { _arena.Rewind(_offset, _overflowBlocks, _overflowBytes); }
+
+	private:
+		Scope(const Scope&);
+		Scope& operator=(const Scope&);
+
+		FrameArena& _arena;
+		size_t _offset;
+		size_t _overflowBlocks;
+		size_t _overflowBytes;
+	};
+
+	/*
+		Description:
+			Releases everything allocated since the last Reset. If the block overflowed, it is replaced with one
+			large enough for the whole phase.
+	*/
+	void Reset()
+	{
+		const size_t phaseBytes = std::max(_phasePeakBytes, _offset + _overflowBytes);
+		_peakBytes = std::max(_peakBytes, phaseBytes);
+
+		_overflow.clear();
+		_overflowBytes = 0;
+		_offset = 0;
+		_phasePeakBytes = 0;
+
+		if (phaseBytes > _capacity)
+			Grow(phaseBytes * 2);
+	}
+
+	//Uninitialized storage for count values. The arena never runs destructors, so only trivially destructible types are allowed
+	template <typename T>
+	Span<T> AllocateArray(const size_t& count)
+	{
+		static_assert(std::is_trivially_destructible<T>::value, "FrameArena never runs destructors");
+		return Span<T>(static_cast<T*>(allocate(count * sizeof(T), alignof(T))), count);
+	}
+
+	/* Getters */
+	size_t GetCapacity() const { return _capacity; }
+	size_t GetPeakBytes() const { return _peakBytes; } //Most bytes used by a single phase so far
+
+private:
+	FrameArena() { Grow(64 * 1024); }
+	FrameArena(const FrameArena&);
+	FrameArena& operator=(const FrameArena&);
+
+	void* do_allocate(size_t bytes, size_t alignment) override
+	{
+		const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(_block.get()) + _offset;
+		const size_t padding = (alignment - address % alignment) % alignment;
+
+		if (_offset + padding + bytes <= _capacity)
+		{
+			_offset += padding + bytes;
+			return _block.get() + _offset - bytes;
+		}
+
+		//Out of room until the next Reset. Over-allocate so the result can be aligned
+		_overflow.emplace_back(new unsigned char[bytes + alignment]);
+		_overflowBytes += bytes + alignment;
+
+		const std::uintptr_t overflowAddress = reinterpret_cast<std::uintptr_t>(_overflow.back().get());
+		return _overflow.back().get() + (alignment - overflowAddress % alignment) % alignment;
+	}
+
+	void do_deallocate(void* memory, size_t bytes, size_t alignment) override {} //Released all at once by Reset or a Scope
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+	void Grow(const size_t capacity)
+	{
+		_block.reset(new unsigned char[capacity]);
+		_capacity = capacity;
+	}
+
+	void Rewind(const size_t& offset, const size_t& overflowBlocks, const size_t& overflowBytes)
+	{
+		_phasePeakBytes = std::max(_phasePeakBytes, _offset + _overflowBytes);
+		_offset = offset;
+		_overflow.resize(overflowBlocks);
+		_overflowBytes = overflowBytes;
+	}
+
+	std::unique_ptr<unsigned char[]> _block; //Where allocations are bumped from
+	size_t _capacity = 0;
+	size_t _offset = 0; //Bytes of _block in use
+
+	std::vector<std::unique_ptr<unsigned char[]>> _overflow; //Heap blocks for allocations that didn't fit in _block
+	size_t _overflowBytes = 0;
+
+	size_t _phasePeakBytes = 0; //Most bytes in use at once since the last Reset, including ones a Scope already released
+	size_t _peakBytes = 0;
+};
@@ -0,0 +1,38 @@
+//
+//  LaunchOptions.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include "Common.h"
+
+#include <SDL.h>
+#include <string>
+
+//Settings chosen on the command line. See Resources::Strings for the flags
+struct LaunchOptions
+{
+	static LaunchOptions Parse(int argc, char* args[]);
+
+	bool _BundleAssets = false; //Write the AssetBundle and exit instead of playing
+	RenderingBackend _RenderingBackend = RenderingBackend::ACCELERATED;
+	bool _Uncapped = false; //Run one simulation tick per loop without waiting on real time
+	int _TickLimit = 0; //Quit after simulating this many ticks. 0 runs until the player quits
+	bool _Profile = false; //Record profiler zones from the start and write a trace on quit
+	bool _ProfileOverlay = false; //Show the profiler's rolling zone timings on screen
+	bool _Deterministic = false; //Gameplay Timers follow the SimulationClock instead of the wall clock
+	Uint32 _Seed = 1; //World seed in deterministic mode
+	std::string _BenchmarkReport; //Where to write the GameBenchmark report. Empty when not benchmarking
+	std::string _RecordPath; //Where InputRecorder writes the session. Empty when not recording
+	std::string _ReplayPath; //Recording that ReplayInputController plays back. Empty when playing live
+	int _StressEnemies = 0; //Enemies of each type in the generated StressScenario. 0 plays Level 01
+	int _StressPickups = 0;
+	bool _StressGrid = false; //StressScenario placement. Scattered when false
+	std::string _StatsPath; //Where to stream per frame Stats. Empty when not streaming
+	std::string _AllocationReport; //Where to write the AllocationTracker report. Empty when allocations aren't tracked
+	int _AllocationThreshold = 0; //Steady state frames allocating more than this are flagged
+};
@@ -0,0 +1,113 @@
+//
+//  Profiler.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include "AllocationTracker.h"
+
+#include <atomic>
+#include <memory>
+#include <SDL.h>
+#include <string>
+#include <vector>
+
+/*
+	Records timed zones from any thread into a fixed size ring buffer using SDL's high resolution counter.
+
+	Recording is lock free: writers claim a slot with a single atomic increment and publish it with a sequence number, so
+	the simulation and render threads never wait on one another. Once the buffer wraps, the oldest zones are overwritten.
+	The buffer can be dumped as Chrome trace JSON (load it in about:tracing) or summarized for the on screen overlay.
+
+	Nothing is recorded until the profiler is enabled. A disabled ProfileZone costs a single atomic load and a swap of the
+	thread's current zone for the AllocationTracker.
+*/
+class Profiler final
+{
+public:
+	//Rolling timings of a single zone
+	struct ZoneSummary
+	{
+		const char* _Name = nullptr;
+		double _AverageMilliseconds = 0.0;
+		double _WorstMilliseconds = 0.0;
+		int _Count = 0;
+	};
+
+	static Profiler& GetInstance();
+
+	void RecordZone(const char* name, const Uint64 start, const Uint64 end);
+	bool WriteChromeTrace(const std::string& filePath) const;
+	std::vector<ZoneSummary> GetZoneSummaries(const double& windowSeconds) const;
+	std::vector<ZoneSummary> GetZoneSummariesSince(const Uint64 since) const;
+
+	/* Getters */
+	bool IsEnabled() const { return _enabled.load(std::memory_order_relaxed); }
+
+	/* Setters */
+	void SetEnabled(const bool enabled) { _enabled.store(enabled, std::memory_order_relaxed); }
+
+private:
+	Profiler();
+	Profiler(const Profiler&);
+	Profiler& operator=(const Profiler&);
+
+	//A single recorded zone. _Sequence is 0 while the slot is being written, otherwise one past the index that wrote it
+	struct Event
+	{
+		std::atomic<Uint64> _Sequence{ 0 };
+		const char* _Name = nullptr; //Zone names are string literals, so the pointer stays valid and identifies the zone
+		Uint64 _Start = 0;
+		Uint64 _End = 0;
+		Uint32 _ThreadId = 0;
+	};
+
+	struct EventCopy
+	{
+		const char* _Name;
+		Uint64 _Start;
+		Uint64 _End;
+		Uint32 _ThreadId;
+	};
+
+	std::vector<EventCopy> CopyEvents() const;
+	double ToMicroseconds(const Uint64 ticks) const;
+	std::vector<ZoneSummary> Summarize(const std::vector<EventCopy>& events, const Uint64 windowStart) const;
+
+	static const Uint64 CAPACITY = 1 << 16; //Roughly a few seconds of zones at 60 ticks per second
+
+	std::unique_ptr<Event[]> _events;
+	std::atomic<Uint64> _nextEvent{ 0 }; //Total number of zones ever recorded
+	std::atomic<bool> _enabled{ false };
+
+	Uint64 _frequency = 1; //Counter ticks per second
+	Uint64 _epoch = 0; //Counter value when the profiler was created. Trace timestamps are relative to this
+};
+
+/*
+	Times the scope it is declared in. The name must be a string literal.
+	Allocations made inside the scope are charged to it by the AllocationTracker.
+
+	Usage:
+		ProfileZone zone("Update/Collisions");
+*/
+class ProfileZone final
+{
+public:
+	ProfileZone(const char* name) : _name(name), _parent(AllocationTracker::EnterZone(name)), _start(Profiler::GetInstance().IsEnabled() ? SDL_GetPerformanceCounter() : 0) {}
+	~ProfileZone()
+	{
+		if (_start != 0)
+			Profiler::GetInstance().RecordZone(_name, _start, SDL_GetPerformanceCounter());
+		AllocationTracker::LeaveZone(_parent);
+	}
+
+private:
+	const char* _name = nullptr;
+	const char* _parent = nullptr; //Zone that was open on this thread before this one
+	Uint64 _start = 0; //0 when the profiler was disabled as the zone started
+};
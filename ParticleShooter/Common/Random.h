@@ -0,0 +1,53 @@
+//
+//  Random.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <random>
+
+/*
+	Seeded pseudo random number generator. Two generators given the same seed produce the same sequence on every platform,
+	since only the raw Mersenne Twister output (whose sequence is fixed by the standard) is used.
+
+	Gameplay code draws from the world instance, which the GameManager seeds whenever a level starts. Anything that doesn't
+	affect the simulation, such as screen shake, should own a separate generator so it doesn't disturb the world's sequence.
+*/
+class Random final
+{
+public:
+	Random(const std::uint32_t seed = 1) { Seed(seed); }
+
+	void Seed(const std::uint32_t seed)
+	{
+		_seed = seed;
+		_engine.seed(seed);
+	}
+
+	//Returns a whole number from 0 up to, but not including, max. Always 0 if max isn't positive
+	int Range(const int max)
+	{
+		if (max <= 0)
+			return 0;
+
+		return static_cast<int>(_engine() % static_cast<std::uint32_t>(max));
+	}
+
+	/* Getters */
+	std::uint32_t GetSeed() const { return _seed; }
+
+	static Random& GetWorldInstance()
+	{
+		static Random world;
+		return world;
+	}
+
+private:
+	std::mt19937 _engine;
+	std::uint32_t _seed = 1;
+};
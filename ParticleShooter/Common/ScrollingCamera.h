@@ -20,6 +20,7 @@ public:
 	void Update(const Vector2& playerPosition);
 
 	Vector2 GetPosition() const;
+	Vector2 GetInterpolatedPosition(const float& alpha) const; //Blends from the position before the last Update to the current one
 	Vector2 GetDisplacement() const { return _bounds._Origin - _cameraPreviousPosition; }
 
 	void ResetPlayerPosition(const Vector2& playerPosition);
@@ -0,0 +1,33 @@
+//
+//  SimulationClock.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include "Common.h"
+
+#include <SDL.h>
+
+/*
+	Game time measured in fixed simulation ticks rather than wall clock time. The GameManager advances it once at the start of
+	every Update, so anything timed against it behaves identically no matter how fast the machine or the render loop runs.
+
+	Timers read from it when constructed with TimeSource::SIMULATION, or by default once deterministic mode is enabled.
+*/
+class SimulationClock final
+{
+public:
+	static void Advance() { TICKS++; } //Moves time forward by a single fixed tick
+	static void Reset() { TICKS = 0; }
+
+	/* Getters */
+	static Uint64 GetTicks() { return TICKS; }
+	static Uint32 GetMilliseconds() { return static_cast<Uint32>(TICKS * 1000 / DESIRED_UPDATES_PER_SECOND); }
+
+private:
+	static Uint64 TICKS; //Ticks simulated since launch
+};
@@ -0,0 +1,141 @@
+//
+//  SlotMap.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+//Refers to a value stored in a SlotMap. Stays valid until that value is erased, no matter how the map is rearranged
+struct SlotHandle
+{
+	std::uint32_t _Slot = 0;
+	std::uint32_t _Generation = 0; //0 is never handed out, so a default handle never refers to anything
+
+	bool operator==(const SlotHandle& other) const { return _Slot == other._Slot && _Generation == other._Generation; }
+	bool operator!=(const SlotHandle& other) const { return !(*this == other); }
+};
+
+/*
+	Unordered container that keeps its values packed in one contiguous array for fast iteration, while
+	handing out handles that survive other values being erased.
+
+	Each handle names a slot. The slot remembers where its value currently sits in the packed array and a generation
+	that is bumped whenever its value is erased, so handles to erased values are detected instead of
+	reaching whichever value reused the slot. Erasing moves the last value into the hole.
+*/
+template <typename T>
+class SlotMap
+{
+public:
+	/*
+		Description:
+			Appends a value to the end of the packed array.
+
+		Return:
+			SlotHandle - Refers to the value until it is erased
+	*/
+	SlotHandle Insert(T value)
+	{
+		std::uint32_t slot;
+		if (!_freeSlots.empty())
+		{
+			slot = _freeSlots.back();
+			_freeSlots.pop_back();
+		}
+		else
+		{
+			slot = static_cast<std::uint32_t>(_slots.size());
+			_slots.push_back(Slot());
+		}
+
+		_slots[slot]._Index = static_cast<std::uint32_t>(_values.size());
+		_values.push_back(std::move(value));
+		_valueSlots.push_back(slot);
+
+		return { slot, _slots[slot]._Generation };
+	}
+
+	/*
+		Description:
+			Removes the value the handle refers to by moving the last value into its place.
+
+		Return:
+			bool - False if the handle was stale and nothing was erased
+	*/
+	bool Erase(const SlotHandle& handle)
+	{
+		if (!Contains(handle))
+			return false;
+
+		const std::uint32_t index = _slots[handle._Slot]._Index;
+		if (index != _values.size() - 1)
+		{
+			_values[index] = std::move(_values.back());
+			_valueSlots[index] = _valueSlots.back();
+			_slots[_valueSlots[index]]._Index = index;
+		}
+
+		_values.pop_back();
+		_valueSlots.pop_back();
+		Release(handle._Slot);
+		return true;
+	}
+
+	//Erases every value. Every outstanding handle goes stale
+	void Clear()
+	{
+		for (const std::uint32_t slot : _valueSlots)
+			Release(slot);
+
+		_values.clear();
+		_valueSlots.clear();
+	}
+
+	bool Contains(const SlotHandle& handle) const
+	{
+		return handle._Slot < _slots.size() && _slots[handle._Slot]._Generation == handle._Generation;
+	}
+
+	//Returns nullptr if the handle is stale
+	T* Get(const SlotHandle& handle) { return Contains(handle) ? &_values[_slots[handle._Slot]._Index] : nullptr; }
+	const T* Get(const SlotHandle& handle) const { return Contains(handle) ? &_values[_slots[handle._Slot]._Index] : nullptr; }
+
+	/* Packed Iteration. Order changes whenever a value is erased */
+	size_t Size() const { return _values.size(); }
+	bool Empty() const { return _values.empty(); }
+	T& operator[](const size_t& index) { return _values[index]; }
+	const T& operator[](const size_t& index) const { return _values[index]; }
+	typename std::vector<T>::iterator begin() { return _values.begin(); }
+	typename std::vector<T>::iterator end() { return _values.end(); }
+	typename std::vector<T>::const_iterator begin() const { return _values.begin(); }
+	typename std::vector<T>::const_iterator end() const { return _values.end(); }
+
+private:
+	struct Slot
+	{
+		std::uint32_t _Index = 0; //Where the slot's value sits in _values
+		std::uint32_t _Generation = 1; //Bumped every time the slot's value is erased
+	};
+
+	void Release(const std::uint32_t& slot)
+	{
+		_slots[slot]._Generation++;
+		if (_slots[slot]._Generation == 0) //Wrapped around. 0 is reserved for default handles
+			_slots[slot]._Generation = 1;
+
+		_freeSlots.push_back(slot);
+	}
+
+	std::vector<T> _values; //Packed. Iterated every frame
+	std::vector<std::uint32_t> _valueSlots; //The slot owning each value in _values, so a moved value's slot can be updated
+	std::vector<Slot> _slots; //Indexed by SlotHandle::_Slot
+	std::vector<std::uint32_t> _freeSlots; //Slots whose value was erased, ready for reuse
+};
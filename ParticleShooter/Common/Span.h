@@ -0,0 +1,52 @@
+//
+//  Span.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <vector>
+
+/*
+	A non owning view of a contiguous run of values. Lets functions hand out or take arrays without committing to
+	how they are stored: FrameArena memory, a std::vector using any allocator, or a braced list built for the call.
+
+	A Span is only valid for as long as the values it views. Spans over FrameArena memory expire when the arena is Reset.
+*/
+template <typename T>
+class Span
+{
+public:
+	Span() = default;
+	Span(T* data, const size_t& size) : _data(data), _size(size) {}
+
+	template <typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+	Span(const Span<U>& other) : _data(other.data()), _size(other.size()) {}
+
+	template <typename Allocator>
+	Span(std::vector<typename std::remove_const<T>::type, Allocator>& values) : _data(values.data()), _size(values.size()) {}
+
+	template <typename Allocator>
+	Span(const std::vector<typename std::remove_const<T>::type, Allocator>& values) : _data(values.data()), _size(values.size()) {}
+
+	Span(std::initializer_list<typename std::remove_const<T>::type> values) : _data(values.begin()), _size(values.size()) {} //Only lives until the end of the call it's passed to
+
+	T* begin() const { return _data; }
+	T* end() const { return _data + _size; }
+	T& operator[](const size_t& index) const { return _data[index]; }
+
+	/* Getters */
+	T* data() const { return _data; }
+	size_t size() const { return _size; }
+	bool empty() const { return _size == 0; }
+
+private:
+	T* _data = nullptr;
+	size_t _size = 0;
+};
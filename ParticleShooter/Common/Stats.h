@@ -0,0 +1,99 @@
+//
+//  Stats.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include "Common.h"
+
+#include <array>
+#include <atomic>
+#include <fstream>
+#include <string>
+
+//Everything counted once per frame. COUNT must stay last
+enum class StatCounter
+{
+	COLLIDERS, //Colliders registered with the CollisionManager
+	BROADPHASE_PAIRS, //Collider pairs that survived the distance and filter checks and went on to SAT
+	AXIS_PROJECTIONS, //Polygons or points projected onto a separating axis
+	COLLISIONS, //Colliding pairs
+	DRAW_CALLS, //Sprites and debug lines submitted to the render thread
+	TEXTURE_BINDS, //Times consecutive sprites switched textures
+	PARTICLES_SPAWNED,
+	SOUNDS_TRIGGERED,
+	HEAP_ALLOCATIONS, //Calls to operator new from any thread
+	TICKS_SIMULATED, //Simulation ticks run, whether governed, uncapped or benchmarked
+	TICKS_DROPPED, //Ticks the FrameGovernor skipped instead of catching up on
+	BUDGET_OVERRUNS, //1 when the frame's work took longer than a simulation tick
+	QUALITY_LEVEL, //The FrameGovernor's current quality level. 0 is full quality
+	PROJECTILES_CREATED, //Projectiles cloned because their ProjectilePool had none free
+	PROJECTILES_RECYCLED, //Projectiles re-armed from a ProjectilePool
+	PROJECTILE_POOL_SIZE, //Projectiles held by every ProjectilePool
+	PROJECTILE_POOL_HIGH_WATER, //Size of the largest ProjectilePool since launch
+	COUNT
+};
+
+/*
+	Cheap per frame engine counters. Systems bump counters as they work and main closes out each frame with EndFrame, which
+	keeps the finished frame around for reading and optionally streams it as a row of CSV or JSON Lines for charting a
+	whole run.
+
+	Incrementing is a plain integer add, so every counter apart from heap allocations may only be touched from the
+	simulation thread. Heap allocations are counted atomically by the global operator new in AllocationTracker.cpp.
+
+	The counting half lives entirely in this header so that physics code can be compiled into the unit tests on its own.
+*/
+class Stats final
+{
+public:
+	static Stats& GetInstance()
+	{
+		static Stats stats;
+		return stats;
+	}
+
+	void Increment(const StatCounter& counter, const int amount = 1) { _counters[static_cast<int>(counter)] += amount; }
+	void Set(const StatCounter& counter, const int value) { _counters[static_cast<int>(counter)] = value; } //For gauges such as COLLIDERS that hold a value rather than a per frame sum
+	void SetLiveGameObjects(const RenderingLayer& layer, const int count) { _liveGameObjects[static_cast<int>(layer)] = count; }
+
+	void EndFrame();
+	bool OpenLog(const std::string& filePath);
+	void CloseLog();
+
+	/* Getters */
+	int GetLastFrame(const StatCounter& counter) const { return _lastFrameCounters[static_cast<int>(counter)]; } //Value of the counter in the most recently finished frame
+	int GetLastFrameLiveGameObjects(const RenderingLayer& layer) const { return _lastFrameLiveGameObjects[static_cast<int>(layer)]; }
+	int GetFrameCount() const { return _frameCount; }
+
+	static void CountAllocation() { HEAP_ALLOCATIONS.fetch_add(1, std::memory_order_relaxed); }
+
+private:
+	Stats() {}
+	Stats(const Stats&);
+	Stats& operator=(const Stats&);
+
+	enum class LogFormat { CSV, JSON_LINES };
+
+	static bool IsGauge(const int counter);
+
+	void WriteHeader();
+	void WriteRow();
+	static const char* GetCounterName(const int counter);
+	static const char* GetLayerName(const int layer);
+
+	std::array<int, static_cast<int>(StatCounter::COUNT)> _counters = {}; //The frame being counted
+	std::array<int, RENDERING_LAYER_COUNT> _liveGameObjects = {};
+	std::array<int, static_cast<int>(StatCounter::COUNT)> _lastFrameCounters = {}; //The last finished frame
+	std::array<int, RENDERING_LAYER_COUNT> _lastFrameLiveGameObjects = {};
+	int _frameCount = 0; //Frames finished since launch
+
+	std::ofstream _log; //Only open while streaming. Flushed and closed on destruction if CloseLog is never called
+	LogFormat _logFormat = LogFormat::CSV;
+
+	static std::atomic<int> HEAP_ALLOCATIONS; //Allocations since the last EndFrame
+};
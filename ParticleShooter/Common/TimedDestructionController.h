@@ -22,7 +22,9 @@ public:
 	TimedDestructionController(const ObserverController& observers, const float& time = -1) : _observerController(observers), _destructionTime(time) {}
 
 	bool TimeIsUp();
+	void Reset() { _destroyed = false; _destructionTimer.Stop(); } //Restarts the countdown the next time TimeIsUp is checked
 
+	bool GetDestroyed() const { return _destroyed; } //Whether TimeIsUp has already reported the destruction
 	void SetDestructionTime(const float& time) { _destructionTime = time; }
 
 	void operator=(const TimedDestructionController& source);
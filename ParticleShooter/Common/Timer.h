@@ -10,11 +10,19 @@
 
 #include <SDL.h>
 
+//Where a Timer reads the current time from
+enum class TimeSource
+{
+    WALL_CLOCK = 0, //Real time since SDL was initialized
+    SIMULATION //Fixed ticks of the SimulationClock. Reproducible between runs
+};
+
 //Basic Timer helper class which can return elapsed game time seconds since being started
 class Timer
 {
 public:
-    Timer() = default;
+    Timer() : _source(DEFAULT_SOURCE) {}
+    Timer(const TimeSource& source) : _source(source) {}
 
     void Start();
     void Stop();
@@ -23,8 +31,16 @@ public:
     Uint32 GetMilliseconds() const;
     float GetSeconds() const;
     bool GetActive() const { return _active; }
+    TimeSource GetTimeSource() const { return _source; }
+
+    static Uint32 GetCurrentMilliseconds(const TimeSource& source);
+    static TimeSource GetDefaultTimeSource() { return DEFAULT_SOURCE; }
+    static void SetDefaultTimeSource(const TimeSource& source) { DEFAULT_SOURCE = source; } //Only affects Timers constructed afterwards
     
 private:
     Uint32 _millisecondsSinceStarting = 0; //How many MS have passed since "Start" was called
     bool _active = false;
+    TimeSource _source = TimeSource::WALL_CLOCK;
+
+    static TimeSource DEFAULT_SOURCE; //Used by Timers that don't pick a source themselves
 };
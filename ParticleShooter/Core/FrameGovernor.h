@@ -0,0 +1,63 @@
+//
+//  FrameGovernor.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include <SDL.h>
+
+//Optional work that can be scaled back when the game can't keep up. Applied through GameManager::SetQuality
+struct QualitySettings
+{
+	float _ParticleSpawnRate = 1.0f; //Fraction of requested particles that are actually spawned
+	float _CullingMargin = 1.0f; //Fraction of the off screen padding kept around rotated sprites. Lower values cull sooner at the screen edges
+	bool _ParallaxBackgrounds = true; //Whether the level's parallax background layers are drawn
+};
+
+/*
+	Keeps the fixed step main loop from spiraling after a long frame and holds the frame rate under sustained load.
+
+	Each frame may only simulate up to MAX_CATCH_UP_TICKS. Lag beyond that is dropped rather than carried, so a single hitch
+	(a wave spawn, an asset load) slows the game down for a moment instead of making every following frame longer.
+
+	Frames whose own work takes longer than the frame budget are counted as overruns. Once every evaluation period, if most
+	frames overran, the quality level is lowered by one step. It is raised again after several calm periods in a row. Ticks,
+	drops, overruns and the quality level are all reported to Stats.
+*/
+class FrameGovernor final
+{
+public:
+	FrameGovernor(const double& frameBudgetMilliseconds);
+
+	int BeginFrame(double& lag);
+	bool EndFrame();
+
+	/* Getters */
+	int GetQualityLevel() const { return _qualityLevel; } //0 is full quality. Higher levels do less optional work
+	const QualitySettings& GetQualitySettings() const;
+
+	static const int MAX_CATCH_UP_TICKS = 4;
+	static const int QUALITY_LEVEL_COUNT = 4;
+
+private:
+	void Evaluate();
+
+	static const int EVALUATION_MILLISECONDS = 1000; //How much real time each quality decision looks back over
+	static const int CALM_EVALUATIONS_BEFORE_RECOVERING = 3; //Evaluations in a row with almost no overruns before quality is raised
+	const double DEGRADE_OVERRUN_SHARE = 0.5; //Share of overrunning frames in an evaluation that lowers the quality
+	const double RECOVER_OVERRUN_SHARE = 0.05; //Share of overrunning frames in an evaluation that still counts as calm
+
+	double _frameBudgetMilliseconds = 0.0; //Both the simulation tick length and how long a frame's work may take
+	double _counterFrequency = 1.0; //SDL performance counter ticks per millisecond
+	Uint64 _frameStart = 0;
+	Uint64 _evaluationStart = 0;
+
+	int _frames = 0; //Frames in the current evaluation
+	int _overruns = 0; //Of which went over budget
+	int _calmEvaluations = 0;
+	int _qualityLevel = 0;
+};
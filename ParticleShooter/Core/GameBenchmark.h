@@ -0,0 +1,62 @@
+//
+//  GameBenchmark.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include "ScriptedInput.h"
+
+#include <map>
+#include <SDL.h>
+#include <string>
+#include <vector>
+
+class GameManager;
+
+/*
+	End to end performance run of the whole game. Drives a GameManager with ScriptedInput for a fixed number of ticks as fast
+	as the machine allows, timing every Update + Render pair.
+
+	Meant to be run with the headless backend so the numbers measure the engine rather than the GPU or vsync. The report covers
+	ticks per second, p50/p99/max tick times, how many GameObjects were alive and a per subsystem breakdown taken from the
+	Profiler's zones.
+*/
+class GameBenchmark final
+{
+public:
+	GameBenchmark(const int tickCount = DEFAULT_TICK_COUNT);
+
+	void Run(GameManager& game);
+	bool WriteReport(const std::string& filePath) const;
+
+	static const int DEFAULT_TICK_COUNT = 3600; //A minute of gameplay at the desired update rate
+
+private:
+	//Running totals for a single profiler zone over the whole benchmark
+	struct ZoneTotal
+	{
+		double _TotalMilliseconds = 0.0;
+		double _WorstMilliseconds = 0.0;
+		int _Count = 0;
+	};
+
+	void CollectZones(const Uint64 since);
+	double GetTickPercentile(const double& percentile) const;
+
+	static const int TICKS_PER_ZONE_COLLECTION = 512; //Harvests the Profiler's ring buffer well before it can wrap
+
+	ScriptedInput _script;
+	int _tickCount = DEFAULT_TICK_COUNT;
+	int _restarts = 0; //Times the player died or won and the level was restarted
+	Uint64 _stateHash = 0; //GameManager::GetStateHash after the last tick. Identical between deterministic runs with the same seed
+	int _peakGameObjects = 0; //Most GameObjects alive in the scene at the end of any tick
+	double _meanGameObjects = 0.0; //Live GameObjects averaged over every tick. What tick times are plotted against in scaling tests
+
+	std::vector<double> _tickMilliseconds; //Sorted once the run completes
+	double _totalSeconds = 0.0;
+	std::map<std::string, ZoneTotal> _zones;
+};
@@ -12,50 +12,69 @@
 #include "GameObjectObserver.h"
 #include "GameObjectRegistryService.h"
 #include "LevelManager.h"
+#include "ParticleSystem.h"
 #include "Player.h"
+#include "Profiler.h"
 #include "Renderer.h"
+#include "SceneComponents.h"
 #include "ScrollingCamera.h"
+#include "SlotMap.h"
 #include "SoundManager.h"
 #include "UserInterfaceManager.h"
 
+#include <array>
 #include <memory>
-#include <list>
 #include <vector>
 
 class GameObject;
 struct InputState;
+struct QualitySettings;
 
 /*
 	Central hub of the game engine. Connects the major components including Physics, rendering, input,
 	UI, and sound.
 	
-	Holds scene manager responsibilities with a list of Game Objects that get updated and rendered each frame.
+	Holds scene manager responsibilities with Game Objects, bucketed by RenderLayer, that get updated and rendered each frame.
  */
 class GameManager final : public GameObjectObserver, public GameObjectRegistryService
 {
 public:
-    GameManager();
+    GameManager(const RenderingBackend& renderingBackend = RenderingBackend::ACCELERATED, const Uint32 seed = 1);
 
-    void Initialize();
+    void Initialize(const std::shared_ptr<Level>& startingLevel = nullptr);
 
     void QuitGame();
     
     void Update(const InputState& inputState);
-    void Render();
+    void Render(const float& interpolation = 1.0);
 
     void Notify(const GameObjectEvent& eventType) override;
     void Notify(const GameObjectEvent& eventType, const bool begin) override;
-    void Notify(const GameObjectEvent& eventType, const std::list<std::shared_ptr<GameObject>>::iterator& objectId) override;
+    void Notify(const GameObjectEvent& eventType, GameObject* gameObject) override;
 
     void AddGameObjectToScene(std::shared_ptr<GameObject> gameObject) override;
+    void AddParticleToScene(const std::shared_ptr<ParticleEmitter>& emitter, const Vector2& position, const Vector2& direction) override;
+
+    /* Getters */
+    bool GetProfilerOverlay() const { return _profilerOverlay; }
+    bool IsGameOver() const { return _gameOver; }
+    Uint64 GetStateHash() const;
+
+    /* Setters */
+    void SetProfilerOverlay(const bool show) { _profilerOverlay = show; } //Draws the Profiler's rolling zone timings on top of the game
+    void SetQuality(const QualitySettings& quality);
 
 private:
-    void InitializeGameWorld();
+    void InitializeGameWorld(const std::shared_ptr<Level>& startingLevel);
     void InitializeLevel();
     void InitializeCamera();
     void InitializePlayer();
 
     void DestroyDeactivatedGameObjects();
+    void AddQueuedGameObjects();
+    void ClearScene();
+    void StorePreviousPoses();
+    void RenderProfilerOverlay();
 
     void Loading();
 
@@ -70,11 +89,26 @@ private:
     std::unique_ptr<SoundManager> _soundManager = nullptr;
     std::unique_ptr<LevelManager> _levelManager = nullptr;
     std::unique_ptr<CollisionManager> _collisionManager = nullptr;
+    std::unique_ptr<ParticleSystem> _particleSystem = nullptr;
 
     std::shared_ptr<ScrollingCamera> _camera = nullptr;
 
-    std::list<std::shared_ptr<GameObject>> _gameObjects; //List of GameObjects being updated and rendered each frame. Sorted by RenderLayer to optimize rendering speed
-    std::vector<std::list<std::shared_ptr<GameObject>>::iterator> _toBeDestroyedQueue; //List of GameObject that have gone out of use and should be destroyed
+    /* Scene Objects */
+    struct SceneHandle
+    {
+        int _Layer = -1;
+        SlotHandle _Slot;
+    };
+
+    std::array<SlotMap<std::shared_ptr<GameObject>>, RENDERING_LAYER_COUNT> _sceneLayers; //GameObjects being updated and rendered each frame. One unordered bucket per RenderLayer
+    std::vector<std::shared_ptr<GameObject>> _toBeAddedQueue; //GameObjects spawned since the last AddQueuedGameObjects. The scene only changes shape between update phases
+    std::vector<std::shared_ptr<GameObject>> _discardedQueue; //Queued GameObjects destroyed before being placed. Released at the start of the next Update
+    std::vector<SceneHandle> _toBeDestroyedQueue; //GameObjects that have gone out of use and should be destroyed. Stale handles are skipped
+    SceneComponents _sceneComponents; //Bulk updates the components of the scene objects that opt in
 
+    Uint32 _seed = 1; //What the world's Random is seeded with whenever a level starts
     bool _gameOver = false;
+    bool _profilerOverlay = false;
+    std::vector<Profiler::ZoneSummary> _profilerSummaries; //What the overlay draws. Only refreshed a few times a second since summarizing copies the Profiler's whole event ring
+    Uint64 _profilerSummariesRefreshed = 0; //SDL_GetPerformanceCounter when _profilerSummaries was last refreshed
 };
@@ -10,6 +10,7 @@
 
 #include "GameObjectObserver.h"
 #include "ObserverController.h"
+#include "SlotMap.h"
 #include "Vector2.h"
 
 #include <memory>
@@ -18,6 +19,7 @@ class ColliderInterface;
 class GraphicsController;
 class InputState;
 class PlayerInfo;
+class SceneComponents;
 class Transform;
 
 /*
@@ -33,16 +35,22 @@ public:
 	virtual ~GameObject() = default;
 
 	virtual void Update(const PlayerInfo& playerInfo, const Vector2& cameraPosition, const InputState& input) = 0;
-	void AddObserver(GameObjectObserver* observer, const std::list<std::shared_ptr<GameObject>>::iterator& objectId) { _observerController.AddObserver(observer, objectId); }
+	void AddObserver(GameObjectObserver* observer) { _observerController.AddObserver(observer, this); } //Observers are told which object sent each event
+	void StorePreviousPose(); //Marks the start of a simulation tick for render interpolation
+	virtual void AttachComponents(SceneComponents& components) {} //Called when joining the scene. Objects can hand components to SceneComponents to be updated in bulk
+	virtual void DetachComponents(SceneComponents& components) {} //Called when leaving the scene
 
 	/* Getters */
 	bool GetActive() const { return _active; } //Active game objects get Update calls from the GameManager
 	const std::shared_ptr<const Transform> GetTransform() const { return _transform; }
 	virtual std::shared_ptr<const GraphicsController> GetGraphicsController() const = 0; //Returning nullptr means that the GameObject has no graphics
 	virtual ColliderInterface* GetCollider() = 0; //Returning nullptr means that the GameObject has no colliders
+	int GetSceneLayer() const { return _sceneLayer; }
+	const SlotHandle& GetSceneHandle() const { return _sceneHandle; }
 
 	/* Setters */
 	void SetIsActive(const bool& active) { _active = active; }
+	void SetSceneSlot(const int& layer, const SlotHandle& handle) { _sceneLayer = layer; _sceneHandle = handle; } //Where the scene is storing this object. Only the scene should set this
 
 protected:
 	std::shared_ptr<Transform> _transform = nullptr; //The position, size, and movement information of the object
@@ -50,4 +58,8 @@ protected:
 
 private:
 	bool _active = true; //Active game objects get Update calls from the GameManager
+
+	/* Scene Bookkeeping */
+	int _sceneLayer = -1; //The layer bucket holding this object. -1 when not in a scene
+	SlotHandle _sceneHandle; //Refers to this object within the layer bucket. Goes stale once the object leaves the scene
 };
\ No newline at end of file
@@ -8,9 +8,6 @@
 
 #pragma once
 
-#include <list>
-#include <memory>
-
 class GameObject;
 
 /* List of Events that a GameObjectObserver can respond to */
@@ -51,7 +48,7 @@ public:
 			Notify(eventType);
 	}
 
-	virtual void Notify(const GameObjectEvent& eventType, const std::list<std::shared_ptr<GameObject>>::iterator& objectId)
+	virtual void Notify(const GameObjectEvent& eventType, GameObject* gameObject)
 	{
 		Notify(eventType);
 	}
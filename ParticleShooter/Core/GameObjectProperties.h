@@ -13,4 +13,5 @@ enum class Property
 	BOUNCE_COUNT,
 	POWER_ACTIVE,
 	OBJECT_STATE
-};
\ No newline at end of file
+};
+const int PROPERTY_COUNT = static_cast<int>(Property::OBJECT_STATE) + 1;
\ No newline at end of file
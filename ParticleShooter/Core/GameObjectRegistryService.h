@@ -8,9 +8,12 @@
 
 #pragma once
 
+#include "Vector2.h"
+
 #include <memory>
 
 class GameObject;
+class ParticleEmitter;
 
 /*
 	Following the Service/Locator design pattern, this service registers new GameObjects to the scene.
@@ -23,4 +26,5 @@ class GameObjectRegistryService
 {
 public:
 	virtual void AddGameObjectToScene(std::shared_ptr<GameObject> gameObject) = 0;
+	virtual void AddParticleToScene(const std::shared_ptr<ParticleEmitter>& emitter, const Vector2& position, const Vector2& direction) = 0;
 };
\ No newline at end of file
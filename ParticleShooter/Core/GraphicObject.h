@@ -10,7 +10,9 @@
 
 #include "AnimatedSingleTextureGraphicsController.h"
 #include "GameObject.h"
+#include "ParticleEmitter.h"
 #include "PropertyController.h"
+#include "SceneComponents.h"
 
 class Texture;
 class TimedDestructionController;
@@ -27,10 +29,13 @@ public:
 	virtual std::shared_ptr<GraphicObject> Clone(const Vector2& position, const Vector2& direction = Vector2(0,-1)) const;
 
 	virtual void Update(const PlayerInfo& playerInfo, const Vector2& cameraPosition, const InputState& input) override;
+	void AttachComponents(SceneComponents& components) override;
+	void DetachComponents(SceneComponents& components) override;
 
 	/* Getters */
 	virtual std::shared_ptr<const GraphicsController> GetGraphicsController() const override { return _graphicsController; }
 	virtual ColliderInterface* GetCollider() override { return nullptr; }
+	std::shared_ptr<ParticleEmitter> GetParticleEmitter() const { return _particleEmitter; } //nullptr unless the object was created from a particle asset
 
 	/* Setters */
 	void SetPosition(const Vector2& position);
@@ -39,8 +44,12 @@ protected:
 	std::unique_ptr<TimedDestructionController> _destructionController = nullptr;
 	std::shared_ptr<AnimatedSingleTextureGraphicsController> _graphicsController = nullptr;
 	PropertyController _propertyController;
+	std::shared_ptr<ParticleEmitter> _particleEmitter = nullptr; //Where clones are spawned instead, when this is a particle prototype
 
 	Vector2 _originalPosition;
+
+	int _sceneComponents = 0; //SceneComponents::ComponentType flags for the components that SceneComponents updates instead of Update. Copied to clones
+	SceneComponents::Handles _componentHandles;
 };
 
 void SpawnGraphicObject(const GraphicObject& prototype, const Vector2& position, const Vector2& direction = Vector2(0, -1));
\ No newline at end of file
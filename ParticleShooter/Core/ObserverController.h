@@ -9,8 +9,6 @@
 #pragma once
 
 #include <vector>
-#include <memory>
-#include <list>
 
 class GameObject;
 class GameObjectObserver;
@@ -23,7 +21,9 @@ class ObserverController
 {
 public:
 	void AddObserver(GameObjectObserver* observer) { _observers.push_back(observer); }
-	void AddObserver(GameObjectObserver* observer, const std::list<std::shared_ptr<GameObject>>::iterator& objectId) { _observerPairs.emplace_back(observer, objectId); }
+	void AddObserver(GameObjectObserver* observer, GameObject* gameObject) { _observerPairs.emplace_back(observer, gameObject); }
+
+	void ClearObservers() { _observers.clear(); _observerPairs.clear(); }
 
 	void NotifyObservers(const GameObjectEvent& eventType) const;
 	void NotifyObservers(const GameObjectEvent& eventType, const bool& begin) const;
@@ -31,5 +31,5 @@ public:
 private:
 	/* Lists of observers that are observing the object holding this controller */
 	std::vector<GameObjectObserver*> _observers;
-	std::vector<std::pair<GameObjectObserver*, const std::list<std::shared_ptr<GameObject>>::iterator>> _observerPairs; //Observers who supply a specific iterator that can be used uniquely respond to an event
+	std::vector<std::pair<GameObjectObserver*, GameObject*>> _observerPairs; //Observers who are also told which object sent the event so they can uniquely respond to it
 };	
\ No newline at end of file
@@ -10,20 +10,58 @@
 
 #include "GameObjectProperties.h"
 
-#include <unordered_map>
+#include <array>
+#include <cstdint>
 
 /*
 	A class which manages a list of properties for any object. The "Property" enum is used as the
 	key to identify which property is surveyed. Useful for keeping stats up to date (ex: Health)
 	and also required by Animators to determine when to transition from one Animation to the next.
+
+	Values are stored in a flat array indexed by Property, with a bit per property marking whether it has been
+	assigned. The version changes whenever a value does, so callers can skip work when nothing has changed.
 */
 class PropertyController
 {
 public:
-	int GetPropertyValue(const Property& propertyId) const;
-	void SetPropertyValue(const Property& propertyId, const int& value);
-	bool ComparePropertyValue(const Property& propertyId, const int& value) const;
+	PropertyController() {}
+	PropertyController(const PropertyController& source) = default;
+	PropertyController& operator=(const PropertyController& source);
+
+	int GetPropertyValue(const Property& propertyId) const
+	{
+		if (!IsAssigned(propertyId))
+			return ReportUnassigned();
+
+		return _values[static_cast<int>(propertyId)];
+	}
+
+	void SetPropertyValue(const Property& propertyId, const int& value)
+	{
+		const int index = static_cast<int>(propertyId);
+		if (IsAssigned(propertyId) && _values[index] == value)
+			return;
+
+		_values[index] = value;
+		_assigned |= 1u << index;
+		_version++;
+	}
+
+	bool ComparePropertyValue(const Property& propertyId, const int& value) const { return GetPropertyValue(propertyId) == value; }
+
+	/* Getters */
+	bool IsAssigned(const Property& propertyId) const { return (_assigned & (1u << static_cast<int>(propertyId))) != 0; }
+	std::uint32_t GetVersion() const { return _version; } //Changes every time a property is assigned a different value
+	std::uint32_t GetAssignedMask() const { return _assigned; } //Bit per Property, set once the property has been given a value
+	const std::array<int, PROPERTY_COUNT>& GetValues() const { return _values; } //Indexed by Property. Unassigned properties read as 0
+
+	static int ReportUnassigned(); //Flags a read of a property that was never assigned. Returns the value it reads as
 
 private:
-	std::unordered_map<Property, int> _propertyMap;
-};
\ No newline at end of file
+
+	static_assert(PROPERTY_COUNT <= 32, "Every Property needs a bit in _assigned");
+
+	std::array<int, PROPERTY_COUNT> _values = {};
+	std::uint32_t _assigned = 0; //Bit per Property. Set once the property has been given a value
+	std::uint32_t _version = 0;
+};
@@ -0,0 +1,82 @@
+//
+//  SceneComponents.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include "SlotMap.h"
+
+class AnimatedSingleTextureGraphicsController;
+class GameObject;
+class TimedDestructionController;
+class Transform;
+
+/*
+	Opt in storage for the components of numerous, simple GameObjects. Each component type is kept in its own dense
+	array and advanced by one tight loop per tick instead of through every object's virtual Update:
+
+		Lifetime - Counts down TimedDestructionControllers. Expired objects notify their observers as usual
+		Animation - Advances animators and applies their transitions
+		Motion - Resolves the collisions simulated this tick and integrates movement
+
+	Like GameObject::Update, each loop skips objects that aren't active. Objects whose lifetime has run out are
+	neither animated nor moved, the same as GraphicObject::Update returning once its time is up.
+
+	Objects that opt in attach their components when they join the scene and detach them when they leave. Their own
+	Update is then left with only the decisions that are unique to them, such as what a collision means.
+	The components themselves still live with their object, so colliders stay where the CollisionManager expects them.
+*/
+class SceneComponents final
+{
+public:
+	//Which of an object's components are advanced by SceneComponents instead of by the object
+	enum ComponentType { MOTION = 1, ANIMATION = 2, LIFETIME = 4 };
+
+	//Where an object's components are stored. Handles of components an object doesn't have are left stale
+	struct Handles
+	{
+		SlotHandle _Motion;
+		SlotHandle _Animation;
+		SlotHandle _Lifetime;
+	};
+
+	Handles Attach(GameObject& owner, const int& components, Transform& transform, AnimatedSingleTextureGraphicsController& graphics, TimedDestructionController& lifetime);
+	void Detach(const Handles& handles);
+	void Clear();
+
+	void Update();
+
+	/* Getters */
+	int GetCount() const { return static_cast<int>(_motion.Size() + _animation.Size() + _lifetime.Size()); }
+
+private:
+	struct LifetimeComponent
+	{
+		GameObject* _Owner = nullptr;
+		TimedDestructionController* _Controller = nullptr;
+	};
+
+	struct AnimationComponent
+	{
+		GameObject* _Owner = nullptr;
+		const TimedDestructionController* _Lifetime = nullptr; //Expired objects stop animating
+		AnimatedSingleTextureGraphicsController* _Graphics = nullptr;
+	};
+
+	struct MotionComponent
+	{
+		GameObject* _Owner = nullptr; //Objects deactivated during their Update, such as Projectiles that hit something, don't move
+		const TimedDestructionController* _Lifetime = nullptr; //Neither do expired ones
+		Transform* _Transform = nullptr;
+	};
+
+	static bool IsUpdating(const GameObject& owner, const TimedDestructionController& lifetime);
+
+	SlotMap<LifetimeComponent> _lifetime;
+	SlotMap<AnimationComponent> _animation;
+	SlotMap<MotionComponent> _motion;
+};
@@ -37,7 +37,7 @@ public:
 	virtual Vector2 GetPlayerStart() const = 0;
 	virtual std::shared_ptr<const Transform> GetTransform() const = 0;
 	virtual std::shared_ptr<const GraphicsController> GetGraphicsController() const = 0;
-	virtual std::vector<ColliderInterface*> GetLevelColliders() = 0;
+	virtual Span<ColliderInterface* const> GetLevelColliders() = 0; //Only valid until the FrameArena is Reset
 
 	bool LevelHasStarted() const { return _levelStarted; }
 
@@ -36,7 +36,7 @@ public:
 	Vector2 GetCurrentLevelPlayerStartingPosition() const { return _currentLevel->GetPlayerStart(); }
 	std::shared_ptr<const Transform> GetCurrentLevelTransform() const { return _currentLevel->GetTransform(); }
 	std::shared_ptr<const GraphicsController> GetCurrentLevelGraphicsController() const { return _currentLevel->GetGraphicsController(); }
-	std::vector<ColliderInterface*> GetCurrentLevelColliders() const { return _currentLevel->GetLevelColliders(); }
+	Span<ColliderInterface* const> GetCurrentLevelColliders() const { return _currentLevel->GetLevelColliders(); }
 
 private:
 	std::shared_ptr<Level> _currentLevel = nullptr;
@@ -33,10 +33,10 @@ public:
 	virtual Vector2 GetPlayerStart() const = 0;
 	virtual std::shared_ptr<const Transform> GetTransform() const = 0;
 	virtual std::shared_ptr<const GraphicsController> GetGraphicsController() const = 0;
-	virtual std::vector<ColliderInterface*> GetLevelColliders() override = 0;
+	virtual Span<ColliderInterface* const> GetLevelColliders() override = 0;
 
 private:
-	void UpdateCurrentWave(GameObjectObserver& observer, const EnemyManager& enemyManager);
+	void UpdateCurrentWave(GameObjectObserver& observer, EnemyManager& enemyManager);
 	void TransitionToNextWave(GameObjectObserver& observer);
 	void StartCurrentWave(GameObjectObserver& observer);
 
@@ -28,17 +28,20 @@ public:
 	/* Getters */
 	Vector2 GetCameraStart() const override;
 	Vector2 GetPlayerStart() const override;
-	std::vector<ColliderInterface*> GetLevelColliders() override;
+	Span<ColliderInterface* const> GetLevelColliders() override;
 	std::shared_ptr<const Transform> GetTransform() const override { return _transform; };
 	std::shared_ptr<const GraphicsController> GetGraphicsController() const override { return _graphicsController; };
 
+protected:
+	virtual void LoadWaves(); //Derived levels can keep the Level 01 map but replace its enemy layout
+
+	Rectangle _bounds = Rectangle(0, 0, 3000, 2000);
+
 private:
-	void LoadWaves();
 	void LoadBackgroundImages();
 	void LoadColliders();
 
 	std::array<Collider, 25> _colliders; //All of the colliders associate with this level
-	Rectangle _bounds = Rectangle(0, 0, 3000, 2000);
 
 	std::shared_ptr<MultiTextureGraphicsController> _graphicsController = nullptr;
 	std::shared_ptr<Transform> _transform = nullptr;
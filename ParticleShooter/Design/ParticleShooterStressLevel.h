@@ -0,0 +1,30 @@
+//
+//  ParticleShooterStressLevel.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include "ParticleShooterLevel01.h"
+#include "StressScenario.h"
+
+/*
+	Level 01's map, background and colliders with its hand made Waves swapped out for a generated StressScenario.
+	Used for scaling tests from the game and the GameBenchmark alike.
+*/
+class ParticleShooterStressLevel : public ParticleShooterLevel01
+{
+public:
+	ParticleShooterStressLevel(const StressScenario& scenario);
+
+protected:
+	void LoadWaves() override;
+
+private:
+	static const int SPAWN_MARGIN = 100; //Keeps spawns off the very edges of the level
+
+	StressScenario _scenario;
+};
@@ -25,17 +25,21 @@ class GameObjectObserver;
 class Round
 {
 public:
-	void StartRound(GameObjectObserver& observer, const EnemyManager& enemyManager);
+	void StartRound(GameObjectObserver& observer, EnemyManager& enemyManager);
+	void ReserveEnemies(EnemyManager& enemyManager) const;
 	void EndRound() { _enemies.clear(); }
 
 	void AddEnemyToSpawn(const int& enemyType, const Vector2& position);
+	void AddEnemyToSpawn(const ObjectId& enemyId, const Vector2& position);
+	void AddItemToSpawn(const ObjectId& itemId, const Vector2& position);
 
 	bool IsRoundComplete() const;
 
 	void Restart() { _roundStarted = false; }
 
 private:
-	std::vector<std::pair<int, Vector2>> _enemiesToSpawn; //The list of Enemies that should be spawned at the start of the round
+	std::vector<std::pair<ObjectId, Vector2>> _enemiesToSpawn; //The list of Enemies that should be spawned at the start of the round
+	std::vector<std::pair<ObjectId, Vector2>> _itemsToSpawn; //Items placed at the start of the round. They don't count towards completing it
 	std::vector<std::weak_ptr<GameObject>> _enemies; //Actual pointers to spawned Enemies
 	bool _roundStarted = false; 
 
@@ -0,0 +1,45 @@
+//
+//  StressScenario.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include "Common.h"
+#include "Rectangle.h"
+
+#include <map>
+#include <SDL.h>
+
+class ParticleShooterLevel;
+
+/*
+	Describes a synthetic level layout for scaling tests. Instead of hand made Tiled waves, every Wave spawns a fixed number
+	of each Enemy type plus a scattering of pickups in a single Round, so the entity count can be dialed from a handful to tens
+	of thousands and frame times compared across the range.
+
+	Rhombuses fire at the Player on their own timers, so a Rhombus heavy scenario doubles as a projectile stress test.
+*/
+struct StressScenario
+{
+	enum class Placement
+	{
+		RANDOM, //Uniformly scattered with the scenario's own seed
+		GRID //Evenly spaced rows covering the spawn area
+	};
+
+	static StressScenario Uniform(const int enemiesPerType, const int pickups = 0);
+
+	void Populate(ParticleShooterLevel& level, const Rectangle& spawnArea) const;
+
+	int GetEnemiesPerWave() const;
+
+	std::map<ObjectId, int> _EnemyCounts; //How many of each Enemy type spawn every Wave
+	int _Pickups = 0; //Items spawned with every Wave, alternating between the pickup types
+	int _Waves = 1;
+	Placement _Placement = Placement::RANDOM;
+	Uint32 _Seed = 1; //Only places spawns. Kept apart from the world seed so the layout doesn't change between launch modes
+};
@@ -26,9 +26,9 @@ public:
 
 	Round* GetRound(const int& roundNumber);
 
-	void StartWave();
+	void StartWave(EnemyManager& enemyManager);
 
-	void Update(GameObjectObserver& observer, const EnemyManager& enemyManager);
+	void Update(GameObjectObserver& observer, EnemyManager& enemyManager);
 
 	bool WaveStarted() const { return _waveStarted; }
 	bool WaveComplete() const { return _rounds.size() == _currentRound; }
@@ -41,4 +41,6 @@ private:
 	bool _startDelay = true;
 	const float _waveStartTime = 3; //delay time before the Wave official starts its first Round
 	Timer _waveStartTimer;
+
+	static const int PREWARM_COPIES_PER_UPDATE = 8; //Enemies copied per Update during the start delay. Enough for a few hundred over the delay
 };
\ No newline at end of file
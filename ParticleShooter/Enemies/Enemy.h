@@ -13,7 +13,7 @@
 #include "EnemyState.h"
 #include "GraphicObject.h"
 
-#include <unordered_map>
+#include <array>
 
 class Animation;
 class Texture;
@@ -41,7 +41,7 @@ private:
 	void Destroyed();
 
 	std::shared_ptr<EnemyState> _state = nullptr; //The current state that the enemy is in
-	std::unordered_map<EnemyStateType, std::shared_ptr<EnemyState>> _stateMappings; //A mapping of each state type and the specific EnemyState that goes along with it (differs per Enemy)
+	std::array<std::shared_ptr<EnemyState>, DESTROYED> _stateMappings; //The specific EnemyState for each state type, indexed by EnemyStateType (differs per Enemy). DESTROYED has no state
 
 	std::shared_ptr<GraphicObject> _destructionParticlesPrototype = nullptr; //Particles that show up where the enemy gets destroyed
 };
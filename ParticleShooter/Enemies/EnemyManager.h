@@ -12,15 +12,27 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 class Enemy;
 
+/*
+	Builds a prototype for each Enemy type and spawns copies of them.
+
+	Copying an Enemy clones every one of its EnemyStates, so copies are made ahead of time whenever possible.
+	Waves reserve the Enemies they are about to spawn and Prewarm copies them a few at a time during the wave's
+	start delay. Spawning then only has to place and activate a waiting copy.
+*/
 class EnemyManager
 {
 public:
 	EnemyManager();
 
-	std::shared_ptr<Enemy> SpawnEnemy(const ObjectId& enemyId, const Vector2& position) const;
+	std::shared_ptr<Enemy> SpawnEnemy(const ObjectId& enemyId, const Vector2& position);
+
+	void Reserve(const ObjectId& enemyId, const int& count);
+	void Prewarm(const int& maxCopies);
+	void ClearReservations() { _reserved.clear(); } //Copies already in the pools are kept for later Waves
 
 private:
 	void ConstructRhombusPrototype();
@@ -28,4 +40,6 @@ private:
 	void ConstructHexagonPrototype();
 
 	std::unordered_map<ObjectId, const Enemy> _enemyMappings;
+	std::unordered_map<ObjectId, std::vector<std::shared_ptr<Enemy>>> _pools; //Inactive copies waiting to be spawned
+	std::unordered_map<ObjectId, int> _reserved; //How many of each Enemy are expected to spawn soon. Prewarm fills the pools up to these counts
 };
\ No newline at end of file
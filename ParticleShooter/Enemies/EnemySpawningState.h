@@ -28,9 +28,9 @@ public:
 
 private:
 
-	const float _warningTime = 2.25;//How long the Warning animation should be played
-	bool _warningComplete = false; //Whether or not the Warning stage is over (once _warningTime has been elapsed)
+	static const float WARNING_TIME;//How long the Warning animation should be played
+	bool _warningComplete = false; //Whether or not the Warning stage is over (once WARNING_TIME has been elapsed)
 
-	const float _spawnTime = 2.5; //Total time spent in the Spawn state
+	static const float SPAWN_TIME; //Total time spent in the Spawn state
 	Timer _spawnTimer;
 };
\ No newline at end of file
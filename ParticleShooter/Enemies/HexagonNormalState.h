@@ -40,7 +40,7 @@ private:
 
 	double _currentAngle = 0; //Current orientation in degrees
 	double _nextAngle = 0; //Next orientation that is being interpolated to. In degrees
-	const double _rotationPerAttack = 29.2; //How much rotation occurs before each attack (in the span of _attackTime)
+	static const double ROTATION_PER_ATTACK; //How much rotation occurs before each attack (in the span of _attackTime)
 
 	bool _rotated = false; //Whether the current orientation is in the standard alias or the rotated alias
 
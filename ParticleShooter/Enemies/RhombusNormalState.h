@@ -37,18 +37,18 @@ private:
 
 	/* Randomized offsets which keep the enemy movement and attacks reasonably unpredictable and varied */
 	Vector2 _playerOffset; //How far off the enemy should track the player from where the player actually is
-	const int _playerOffsetMagnitude = 450; //How accurate they should track the player. The further away from 0, the less accurate
-	const int _speedOffsetMagnitude = 150; //Maximum amount that is applied to a Rhombus's speed to make it particularly fast or slow compared to other enemies
-	const int _attackTimeOffsetMagnitude = 3000; //Maximum amount of time that can be applied to the attack timer in MS
+	static const int PLAYER_OFFSET_MAGNITUDE = 450; //How accurate they should track the player. The further away from 0, the less accurate
+	static const int SPEED_OFFSET_MAGNITUDE = 150; //Maximum amount that is applied to a Rhombus's speed to make it particularly fast or slow compared to other enemies
+	static const int ATTACK_TIME_OFFSET_MAGNITUDE = 3000; //Maximum amount of time that can be applied to the attack timer in MS
 
-	int _minimumSpeed = 100; //Increased randomly according to _speedOffsetMagnitude.
-	const int _accelerationMagnitude = 1000;
+	int _minimumSpeed = 100; //Increased randomly according to SPEED_OFFSET_MAGNITUDE.
+	static const int ACCELERATION_MAGNITUDE = 1000;
 
-	const int _damagedImpulseMagnitude = -150; //The magnitude for the impulse velocity applied when taking damage. Used for exaggeration and animated purposes
+	static const int DAMAGED_IMPULSE_MAGNITUDE = -150; //The magnitude for the impulse velocity applied when taking damage. Used for exaggeration and animated purposes
 
-	const int _distanceFromPlayerToMaintain = 300; //How far away the Enemy should stay from the player
+	static const int DISTANCE_FROM_PLAYER_TO_MAINTAIN = 300; //How far away the Enemy should stay from the player
 
-	float _attackTime = 2; //How often the Enemy should attack. Randomized by _attackTimeOffsetMagnitude
+	float _attackTime = 2; //How often the Enemy should attack. Randomized by ATTACK_TIME_OFFSET_MAGNITUDE
 	Timer _attackTimer;
 
 	std::unique_ptr<ProjectileShooter> _projectileShooter = nullptr;
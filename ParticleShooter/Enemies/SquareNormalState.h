@@ -66,15 +66,15 @@ private:
 	Timer _attackTimer;
 	bool _attacking = false;
 
-	const float _accelerationMagnitude = 8000; //The acceleration Square maintains during it's Attack stage
+	static const float ACCELERATION_MAGNITUDE; //The acceleration Square maintains during it's Attack stage
 
 	Vector2 _attackDirection; //Once a attack is initiated, Square does not change it's direction
 
 	/* List of possible attack directions */
-	const Vector2 UP = Vector2(0, -1);
-	const Vector2 DOWN = Vector2(0, 1);
-	const Vector2 RIGHT = Vector2(1, 0);
-	const Vector2 LEFT = Vector2(-1, 0);
+	static const Vector2 UP;
+	static const Vector2 DOWN;
+	static const Vector2 RIGHT;
+	static const Vector2 LEFT;
 
-	const int _targetSeekingHalfAngle = 5; //If the target (Player) is within the Seeking angle of any of the attack directions, they are "found" by the Square enemy
+	static const int TARGET_SEEKING_HALF_ANGLE = 5; //If the target (Player) is within the Seeking angle of any of the attack directions, they are "found" by the Square enemy
 };
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "EnemyDamagedState.h"
 #include "EnemySpawningState.h"
 #include "EnemyState.h"
+#include "ErrorHandler.h"
 #include "ItemSpawner.h"
 #include "PlayerInfo.h"
 #include "Transform.h"
@@ -10,9 +11,9 @@
 
 Enemy::Enemy() : GraphicObject()
 {
-	_stateMappings.insert({ EnemyStateType::NORMAL, std::make_shared<EnemyNormalState>() });
-	_stateMappings.insert({ EnemyStateType::DAMAGED, std::make_shared<EnemyDamagedState>() });
-	_stateMappings.insert({ EnemyStateType::SPAWNING, std::make_shared<EnemySpawningState>() });
+	_stateMappings[EnemyStateType::NORMAL] = std::make_shared<EnemyNormalState>();
+	_stateMappings[EnemyStateType::DAMAGED] = std::make_shared<EnemyDamagedState>();
+	_stateMappings[EnemyStateType::SPAWNING] = std::make_shared<EnemySpawningState>();
 
 	_state = _stateMappings[EnemyStateType::SPAWNING];
 }
@@ -31,9 +32,10 @@ Enemy::Enemy(const Enemy& source) : GraphicObject(source)
 	_destructionParticlesPrototype = source._destructionParticlesPrototype;
 	_transform->_Collider.SetAssociatedRigidBody(&_transform->_RigidBody);
 
-	for (auto it = source._stateMappings.cbegin(); it != source._stateMappings.cend(); ++it)
+	for (int type = 0; type < static_cast<int>(_stateMappings.size()); type++)
 	{
-		_stateMappings.insert({ (*it).first , (*it).second->Clone() });
+		if (source._stateMappings[type] != nullptr)
+			_stateMappings[type] = source._stateMappings[type]->Clone();
 	}
 
 	_state = _stateMappings[EnemyStateType::SPAWNING];
@@ -52,7 +54,7 @@ std::shared_ptr<Enemy> Enemy::Clone(const Vector2& position) const
 /*
 	Description:
 		Pairs an EnemyStateType to a specific EnemyState implementation.
-		Adds a new State to _stateMappings if one is not already found. Otherwise, overwrites.
+		Overwrites whichever State was previously paired with the type.
 
 	Arguments:
 		type - EnemyStateType. Becomes paired with state in _stateMappings
@@ -60,12 +62,11 @@ std::shared_ptr<Enemy> Enemy::Clone(const Vector2& position) const
 */
 void Enemy::SetEnemyState(const EnemyStateType& type, const std::shared_ptr<EnemyState>& state)
 {
-	const auto foundIt = _stateMappings.find(type);
+	ErrorHandler::Assert(type >= 0 && type < static_cast<int>(_stateMappings.size()), "DESTROYED can't be paired with an EnemyState");
+	if (type < 0 || type >= static_cast<int>(_stateMappings.size()))
+		return;
 
-	if (foundIt == _stateMappings.end())
-		_stateMappings.insert({ type, state });
-	else
-		_stateMappings[type] = state;
+	_stateMappings[type] = state;
 }
 
 void Enemy::StartCurrentState()
@@ -115,11 +116,8 @@ void Enemy::SwitchEnemyState(const EnemyStateType& type)
 {
 	_state->OnEnd();
 
-	const auto foundIt = _stateMappings.find(type);
-	if (foundIt == _stateMappings.end())
-		_state = _stateMappings.at(EnemyStateType::NORMAL);
-	else
-		_state = _stateMappings[type];
+	const bool stateFound = type >= 0 && type < static_cast<int>(_stateMappings.size()) && _stateMappings[type] != nullptr;
+	_state = stateFound ? _stateMappings[type] : _stateMappings[EnemyStateType::NORMAL];
 
 	_propertyController.SetPropertyValue(Property::OBJECT_STATE, type);
 	_state->OnStart(_observerController, _transform, _graphicsController, _propertyController);
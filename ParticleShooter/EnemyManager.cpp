@@ -9,6 +9,8 @@
 #include "Transform.h"
 #include "TriangleExplosion.h"
 
+#include <algorithm>
+
 /*
 	Description:
 		Loads in the textures, animations, and transform information for each of the enemies.
@@ -23,24 +25,77 @@ EnemyManager::EnemyManager()
 
 /*
 	Description:
-		Checks to see if a prototype has been created for the given Id. If so, creates a clone
-		of that enemy while sharing as much resources as possible (textures, animation tree, etc..).
-		Returns nullptr if the enemy prototype can't be found.
+		Checks to see if a prototype has been created for the given Id. If so, activates a prewarmed copy
+		of that enemy, or creates a clone if none are waiting. Copies share as much resources as possible
+		(textures, animation tree, etc..). Returns nullptr if the enemy prototype can't be found.
 
 	Arguments:
 		enemyId - The Id for the enemy type to be cloned
 		position - Where the clone will be spawned
 */
-std::shared_ptr<Enemy> EnemyManager::SpawnEnemy(const ObjectId& enemyId, const Vector2& position) const
+std::shared_ptr<Enemy> EnemyManager::SpawnEnemy(const ObjectId& enemyId, const Vector2& position)
 {
 	const auto found = _enemyMappings.find(enemyId);
-	if (found != _enemyMappings.end())
+	if (found == _enemyMappings.end())
 	{
-		return (*found).second.Clone(position);
+		ErrorHandler::Assert(false, "Tried to spawn an enemy that has not been constructed");
+		return nullptr;
 	}
 
-	ErrorHandler::Assert(false, "Tried to spawn an enemy that has not been constructed");
-	return nullptr;
+	auto& reserved = _reserved[enemyId];
+	reserved = std::max(reserved - 1, 0);
+
+	std::vector<std::shared_ptr<Enemy>>& pool = _pools[enemyId];
+	if (pool.empty())
+		return (*found).second.Clone(position);
+
+	std::shared_ptr<Enemy> enemy = pool.back();
+	pool.pop_back();
+
+	enemy->SetPosition(position);
+	enemy->SetIsActive(true);
+	enemy->_graphicsController->RestartAnimation(); //Its clock has been running since it was prewarmed
+	enemy->StartCurrentState();
+
+	return enemy;
+}
+
+/*
+	Description:
+		Expects count more of the given Enemy to be spawned soon. Copies already waiting in the pool count towards it.
+
+	Arguments:
+		enemyId - The Id for the enemy type that will be spawned
+		count - How many more will be spawned
+*/
+void EnemyManager::Reserve(const ObjectId& enemyId, const int& count)
+{
+	if (_enemyMappings.find(enemyId) != _enemyMappings.end())
+		_reserved[enemyId] += count;
+}
+
+/*
+	Description:
+		Copies reserved Enemies into their pools. Spreading the copies over several frames keeps the
+		start of a Round from copying its whole roster at once.
+
+	Arguments:
+		maxCopies - The most Enemies to copy during this call
+*/
+void EnemyManager::Prewarm(const int& maxCopies)
+{
+	int copies = 0;
+	for (const auto& reservation : _reserved)
+	{
+		std::vector<std::shared_ptr<Enemy>>& pool = _pools[reservation.first];
+		const Enemy& prototype = _enemyMappings.at(reservation.first);
+
+		while (static_cast<int>(pool.size()) < reservation.second && copies < maxCopies)
+		{
+			pool.push_back(std::make_shared<Enemy>(prototype));
+			copies++;
+		}
+	}
 }
 
 void EnemyManager::ConstructRhombusPrototype()
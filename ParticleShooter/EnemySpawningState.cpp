@@ -2,6 +2,9 @@
 #include "EnemySpawningState.h"
 #include "Transform.h"
 
+const float EnemySpawningState::WARNING_TIME = 2.25;
+const float EnemySpawningState::SPAWN_TIME = 2.5;
+
 std::shared_ptr<EnemyState> EnemySpawningState::Clone() const
 {
 	return std::make_shared<EnemySpawningState>();
@@ -29,8 +32,8 @@ void EnemySpawningState::OnStart(ObserverController& observerController, Transfo
 
 /*
 	Description:
-		Waits for the _spawnTimer to elapse _spawnTime while managing the warning animation.
-		Once _spawnTime is elapsed, turn the Collider back on and transition to the Normal state.
+		Waits for the _spawnTimer to elapse SPAWN_TIME while managing the warning animation.
+		Once SPAWN_TIME is elapsed, turn the Collider back on and transition to the Normal state.
 		
 	Arguments:
 		playerInfo - Unused in this derived implementation
@@ -40,12 +43,12 @@ void EnemySpawningState::OnStart(ObserverController& observerController, Transfo
 */
 EnemyStateType EnemySpawningState::Update(const PlayerInfo& playerInfo, ObserverController& observerController, TransformPt& transform, GControllerPt& graphics, PController& properties)
 {
-	if (_spawnTimer.GetSeconds() >= _spawnTime)
+	if (_spawnTimer.GetSeconds() >= SPAWN_TIME)
 	{
 		transform->_Collider.SetIsActive(true);
 		return EnemyStateType::NORMAL;
 	}
-	else if (!_warningComplete && _spawnTimer.GetSeconds() >= _warningTime)
+	else if (!_warningComplete && _spawnTimer.GetSeconds() >= WARNING_TIME)
 	{
 		properties.SetPropertyValue(Property::OBJECT_STATE, static_cast<int>(NORMAL));
 		_warningComplete = true;
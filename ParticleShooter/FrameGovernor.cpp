@@ -0,0 +1,118 @@
+#include "FrameGovernor.h"
+#include "Stats.h"
+
+#include <algorithm>
+
+const int FrameGovernor::MAX_CATCH_UP_TICKS;
+const int FrameGovernor::QUALITY_LEVEL_COUNT;
+
+namespace
+{
+	//From full quality to the cheapest settings the game still looks reasonable with
+	const QualitySettings QUALITY_LEVELS[FrameGovernor::QUALITY_LEVEL_COUNT] =
+	{
+		{ 1.0f, 1.0f, true },
+		{ 0.5f, 1.0f, true },
+		{ 0.5f, 0.5f, false },
+		{ 0.25f, 0.0f, false }
+	};
+}
+
+/*
+	Arguments:
+		frameBudgetMilliseconds - Length of a simulation tick. Frames are expected to finish their work within it
+*/
+FrameGovernor::FrameGovernor(const double& frameBudgetMilliseconds) : _frameBudgetMilliseconds(frameBudgetMilliseconds)
+{
+	_counterFrequency = SDL_GetPerformanceFrequency() / 1000.0;
+	_evaluationStart = SDL_GetPerformanceCounter();
+}
+
+/*
+	Description:
+		Starts timing a frame and decides how many ticks it simulates. Lag past MAX_CATCH_UP_TICKS is dropped.
+
+	Arguments:
+		lag - Real time in milliseconds not yet covered by simulated ticks. Reduced by the ticks handed out and any dropped time
+
+	Return:
+		int - How many ticks to simulate this frame
+*/
+int FrameGovernor::BeginFrame(double& lag)
+{
+	_frameStart = SDL_GetPerformanceCounter();
+
+	const int ticksDue = std::max(static_cast<int>(lag / _frameBudgetMilliseconds), 0);
+	const int ticks = std::min(ticksDue, MAX_CATCH_UP_TICKS);
+	if (ticksDue > ticks)
+		Stats::GetInstance().Increment(StatCounter::TICKS_DROPPED, ticksDue - ticks);
+
+	//Dropped ticks are forgotten along with the simulated ones. Only the partial tick carries into the next frame
+	lag = std::max(lag - ticksDue * _frameBudgetMilliseconds, 0.0);
+
+	return ticks;
+}
+
+/*
+	Description:
+		Finishes timing a frame. Should be called once the frame has been rendered.
+
+	Return:
+		bool - Whether the quality level changed, in which case the new settings should be applied
+*/
+bool FrameGovernor::EndFrame()
+{
+	const Uint64 now = SDL_GetPerformanceCounter();
+
+	_frames++;
+	if ((now - _frameStart) / _counterFrequency > _frameBudgetMilliseconds)
+	{
+		_overruns++;
+		Stats::GetInstance().Increment(StatCounter::BUDGET_OVERRUNS);
+	}
+
+	const int previousLevel = _qualityLevel;
+	if ((now - _evaluationStart) / _counterFrequency >= EVALUATION_MILLISECONDS)
+	{
+		Evaluate();
+		_evaluationStart = now;
+	}
+
+	Stats::GetInstance().Set(StatCounter::QUALITY_LEVEL, _qualityLevel);
+	return _qualityLevel != previousLevel;
+}
+
+const QualitySettings& FrameGovernor::GetQualitySettings() const
+{
+	return QUALITY_LEVELS[_qualityLevel];
+}
+
+/*
+	Description:
+		Moves the quality level by at most one step based on the share of frames that overran since the last evaluation.
+		Lowering is immediate, raising waits for several calm evaluations so the level doesn't flip back and forth.
+*/
+void FrameGovernor::Evaluate()
+{
+	const double overrunShare = _frames > 0 ? static_cast<double>(_overruns) / _frames : 0.0;
+
+	if (overrunShare >= DEGRADE_OVERRUN_SHARE)
+	{
+		_qualityLevel = std::min(_qualityLevel + 1, QUALITY_LEVEL_COUNT - 1);
+		_calmEvaluations = 0;
+	}
+	else if (overrunShare <= RECOVER_OVERRUN_SHARE)
+	{
+		_calmEvaluations++;
+		if (_calmEvaluations >= CALM_EVALUATIONS_BEFORE_RECOVERING)
+		{
+			_qualityLevel = std::max(_qualityLevel - 1, 0);
+			_calmEvaluations = 0;
+		}
+	}
+	else
+		_calmEvaluations = 0;
+
+	_frames = 0;
+	_overruns = 0;
+}
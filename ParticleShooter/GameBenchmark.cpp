@@ -0,0 +1,161 @@
+#include "AllocationTracker.h"
+#include "GameBenchmark.h"
+#include "GameManager.h"
+#include "Profiler.h"
+#include "Stats.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+const int GameBenchmark::DEFAULT_TICK_COUNT;
+
+GameBenchmark::GameBenchmark(const int tickCount) : _tickCount(std::max(tickCount, 1))
+{
+}
+
+/*
+	Description:
+		Simulates and renders the configured number of ticks back to back. Restarts the level whenever it ends so
+		every tick is measured during gameplay.
+
+	Arguments:
+		game - An initialized GameManager. Ideally created with the headless RenderingBackend
+*/
+void GameBenchmark::Run(GameManager& game)
+{
+	Profiler& profiler = Profiler::GetInstance();
+	profiler.SetEnabled(true);
+
+	_tickMilliseconds.clear();
+	_tickMilliseconds.reserve(_tickCount);
+	_zones.clear();
+	_restarts = 0;
+	_peakGameObjects = 0;
+	double totalGameObjects = 0.0;
+
+	const double frequency = static_cast<double>(SDL_GetPerformanceFrequency());
+	const Uint64 runStart = SDL_GetPerformanceCounter();
+	Uint64 collectionStart = runStart;
+
+	for (int tick = 0; tick < _tickCount; tick++)
+	{
+		InputState inputState = _script.GetInputState(tick);
+		if (game.IsGameOver())
+		{
+			inputState._RestartPressed = true;
+			_restarts++;
+		}
+
+		const Uint64 tickStart = SDL_GetPerformanceCounter();
+		game.Update(inputState);
+		game.Render();
+		const Uint64 tickEnd = SDL_GetPerformanceCounter();
+
+		_tickMilliseconds.push_back((tickEnd - tickStart) * 1000.0 / frequency);
+		Stats::GetInstance().EndFrame();
+		AllocationTracker::GetInstance().EndFrame(1);
+
+		int gameObjects = 0;
+		for (int layer = 0; layer < RENDERING_LAYER_COUNT; layer++)
+			gameObjects += Stats::GetInstance().GetLastFrameLiveGameObjects(static_cast<RenderingLayer>(layer));
+		_peakGameObjects = std::max(_peakGameObjects, gameObjects);
+		totalGameObjects += gameObjects;
+
+		if ((tick + 1) % TICKS_PER_ZONE_COLLECTION == 0)
+		{
+			CollectZones(collectionStart);
+			collectionStart = SDL_GetPerformanceCounter();
+		}
+	}
+
+	CollectZones(collectionStart);
+	_totalSeconds = (SDL_GetPerformanceCounter() - runStart) / frequency;
+	_stateHash = game.GetStateHash();
+	_meanGameObjects = totalGameObjects / _tickCount;
+
+	std::sort(_tickMilliseconds.begin(), _tickMilliseconds.end());
+}
+
+/*
+	Description:
+		Folds every profiler zone recorded since a point in time into the run's totals.
+
+	Arguments:
+		since - SDL_GetPerformanceCounter value where the previous collection left off
+*/
+void GameBenchmark::CollectZones(const Uint64 since)
+{
+	for (const Profiler::ZoneSummary& summary : Profiler::GetInstance().GetZoneSummariesSince(since))
+	{
+		ZoneTotal& total = _zones[summary._Name];
+		total._TotalMilliseconds += summary._AverageMilliseconds * summary._Count;
+		total._WorstMilliseconds = std::max(total._WorstMilliseconds, summary._WorstMilliseconds);
+		total._Count += summary._Count;
+	}
+}
+
+/*
+	Arguments:
+		percentile - From 0 to 1
+
+	Return:
+		double - The tick time in milliseconds that the given fraction of ticks finished within (nearest rank)
+*/
+double GameBenchmark::GetTickPercentile(const double& percentile) const
+{
+	if (_tickMilliseconds.empty())
+		return 0.0;
+
+	const size_t rank = static_cast<size_t>(percentile * (_tickMilliseconds.size() - 1) + 0.5);
+	return _tickMilliseconds.at(std::min(rank, _tickMilliseconds.size() - 1));
+}
+
+/*
+	Description:
+		Writes the results of the last Run as JSON and prints a one line summary.
+
+	Arguments:
+		filePath - Where to write the report. Overwritten if it already exists
+
+	Return:
+		bool - Whether or not the report was written
+*/
+bool GameBenchmark::WriteReport(const std::string& filePath) const
+{
+	const int ticks = static_cast<int>(_tickMilliseconds.size());
+	const double ticksPerSecond = _totalSeconds > 0.0 ? ticks / _totalSeconds : 0.0;
+
+	std::cout << ticks << " ticks in " << _totalSeconds << "s (" << ticksPerSecond << " ticks/s). p50 " << GetTickPercentile(0.5)
+		<< "ms, p99 " << GetTickPercentile(0.99) << "ms, max " << GetTickPercentile(1.0) << "ms. " << _meanGameObjects << " GameObjects on average" << std::endl;
+
+	std::ofstream report(filePath, std::ios::trunc);
+	if (!report)
+		return false;
+
+	report << "{\n"
+		<< "  \"ticks\": " << ticks << ",\n"
+		<< "  \"restarts\": " << _restarts << ",\n"
+		<< "  \"state_hash\": \"" << std::hex << _stateHash << std::dec << "\",\n"
+		<< "  \"seconds\": " << _totalSeconds << ",\n"
+		<< "  \"ticks_per_second\": " << ticksPerSecond << ",\n"
+		<< "  \"tick_ms\": {\"p50\": " << GetTickPercentile(0.5) << ", \"p99\": " << GetTickPercentile(0.99) << ", \"max\": " << GetTickPercentile(1.0) << "},\n"
+		<< "  \"game_objects\": {\"mean\": " << _meanGameObjects << ", \"peak\": " << _peakGameObjects << "},\n"
+		<< "  \"zones\": [";
+
+	bool first = true;
+	for (const std::pair<const std::string, ZoneTotal>& zone : _zones)
+	{
+		report << (first ? "\n" : ",\n")
+			<< "    {\"name\": \"" << zone.first << "\""
+			<< ", \"count\": " << zone.second._Count
+			<< ", \"total_ms\": " << zone.second._TotalMilliseconds
+			<< ", \"mean_ms\": " << zone.second._TotalMilliseconds / zone.second._Count
+			<< ", \"max_ms\": " << zone.second._WorstMilliseconds
+			<< ", \"share\": " << (_totalSeconds > 0.0 ? zone.second._TotalMilliseconds / (_totalSeconds * 1000.0) : 0.0) << "}";
+		first = false;
+	}
+	report << "\n  ]\n}\n";
+
+	return report.good();
+}
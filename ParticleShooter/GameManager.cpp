@@ -1,18 +1,30 @@
+#include "FrameArena.h"
+#include "FrameGovernor.h"
 #include "GameManager.h"
 #include "GameObject.h"
 #include "GameObjectRegistryLocator.h"
 #include "GraphicAssetResources.h"
 #include "InputManager.h"
 #include "ParticleShooterLevel01.h"
+#include "Profiler.h"
+#include "Random.h"
+#include "SimulationClock.h"
+#include "Stats.h"
+
+#include <algorithm>
 
 /*
     Description:
         Without being initialized, GameManager is capable of rendering capabilities
+
+    Arguments:
+        renderingBackend - Where frames are drawn. A window by default, or offscreen/nowhere for headless runs
+        seed - Seeds the world's Random every time a level starts
  */
-GameManager::GameManager()
+GameManager::GameManager(const RenderingBackend& renderingBackend, const Uint32 seed) : _seed(seed)
 {
     _camera = std::make_unique<ScrollingCamera>();
-    _renderer = std::make_unique<Renderer>(_camera);
+    _renderer = std::make_unique<Renderer>(_camera, renderingBackend);
     Loading(); //Loading screen while the first level gets Initialized
     GameObjectRegistryLocator::SetService(this);
 }
@@ -20,14 +32,18 @@ GameManager::GameManager()
 /*
 	Description:
 		Constructs each of the engine domains relevant to the game and automatically starts the first level.
+
+	Arguments:
+		startingLevel - The level to play. Level 01 when not given
  */
-void GameManager::Initialize()
+void GameManager::Initialize(const std::shared_ptr<Level>& startingLevel)
 {
     _collisionManager = std::make_unique<CollisionManager>();
+    _particleSystem = std::make_unique<ParticleSystem>();
     _soundManager = std::make_unique<SoundManager>();
     _userInterfaceManager = std::make_unique<UserInterfaceManager>();
 
-    InitializeGameWorld();
+    InitializeGameWorld(startingLevel);
 }
 
 /*
@@ -36,10 +52,14 @@ void GameManager::Initialize()
         The Level Manager loads a level and each of the other components respond to the specifics
         detailed from that level.
  */
-void GameManager::InitializeGameWorld()
+void GameManager::InitializeGameWorld(const std::shared_ptr<Level>& startingLevel)
 {
+    ProfileZone zone("Load/GameWorld");
+
+    Random::GetWorldInstance().Seed(_seed);
+
     _levelManager = std::make_unique<LevelManager>();
-    _levelManager->LoadLevel(std::make_shared<ParticleShooterLevel01>());
+    _levelManager->LoadLevel(startingLevel != nullptr ? startingLevel : std::make_shared<ParticleShooterLevel01>());
 
     InitializeLevel();
     InitializeCamera();
@@ -90,8 +110,8 @@ void GameManager::RestartLevel()
 {
     GameOver();
     _gameOver = false;
-	_gameObjects.clear();
-    _toBeDestroyedQueue.clear();
+    ClearScene();
+    Random::GetWorldInstance().Seed(_seed); //Every attempt plays out the same way given the same inputs
     _levelManager->Restart();
     _userInterfaceManager.reset(new UserInterfaceManager());
     _camera.reset(new ScrollingCamera());
@@ -104,20 +124,94 @@ void GameManager::RestartLevel()
     _levelManager->StartLevel();
 }
 
+/*
+    Description:
+        Scales optional work up or down. Nothing that affects the simulation is touched, so deterministic runs
+        produce the same results at any quality.
+
+    Arguments:
+        quality - Usually chosen by the FrameGovernor
+ */
+void GameManager::SetQuality(const QualitySettings& quality)
+{
+    if (_particleSystem != nullptr)
+        _particleSystem->SetSpawnRate(quality._ParticleSpawnRate);
+
+    _renderer->SetCullingMargin(quality._CullingMargin);
+    _renderer->SetDrawParallaxLayers(quality._ParallaxBackgrounds);
+}
+
 void GameManager::QuitGame()
 {
     GameOver();
-    _renderer.release();
+    _renderer.reset(); //Joins the render thread before SDL shuts down underneath it
     SDL_Quit();
 }
 
+/*
+    Description:
+        Fingerprints the simulation: the tick, the player and the pose and velocity of every GameObject in the scene.
+        In deterministic mode, two runs given the same seed and inputs produce the same hash on every tick.
+
+    Return:
+        Uint64 - FNV-1a hash of the current simulation state
+ */
+Uint64 GameManager::GetStateHash() const
+{
+    Uint64 hash = 14695981039346656037ULL;
+    const auto mix = [&hash](const void* data, const size_t size)
+    {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; i++)
+        {
+            hash ^= bytes[i];
+            hash *= 1099511628211ULL;
+        }
+    };
+    const auto mixTransform = [&mix](const Transform& transform)
+    {
+        const Vector2 origin = transform.GetOrigin();
+        const Vector2 velocity = transform._RigidBody.GetVelocity();
+        const double orientation = transform.GetOrientationAngle();
+        mix(&origin.x, sizeof(origin.x));
+        mix(&origin.y, sizeof(origin.y));
+        mix(&velocity.x, sizeof(velocity.x));
+        mix(&velocity.y, sizeof(velocity.y));
+        mix(&orientation, sizeof(orientation));
+    };
+
+    const Uint64 ticks = SimulationClock::GetTicks();
+    mix(&ticks, sizeof(ticks));
+    mix(&_gameOver, sizeof(_gameOver));
+
+    if (_player != nullptr && _player->GetTransform() != nullptr)
+        mixTransform(*_player->GetTransform());
+
+    for (const SlotMap<std::shared_ptr<GameObject>>& sceneLayer : _sceneLayers)
+    {
+        const size_t count = sceneLayer.Size();
+        mix(&count, sizeof(count));
+
+        for (const std::shared_ptr<GameObject>& gameObject : sceneLayer)
+        {
+            const bool active = gameObject->GetActive();
+            mix(&active, sizeof(active));
+            if (gameObject->GetTransform() != nullptr)
+                mixTransform(*gameObject->GetTransform());
+        }
+    }
+
+    return hash;
+}
+
 void GameManager::GameOver()
 {
     _levelManager->PauseLevel();
     _player->PauseUpdates();
     _renderer->SetScreenShake(false);
     _gameOver = true;
-    _gameObjects.clear();
+    ClearScene();
+    _particleSystem->Clear();
     _collisionManager->RemoveAllColliders();
 }
 
@@ -134,44 +228,164 @@ void GameManager::Loading()
 
 /*
     Description:
-        Goes through the iterators in _toBeDestroyedQueue and removed them from the
-        _gameObjects list. If they have colliders, unregisters them from the collision manager
+        Goes through the GameObjects in _toBeDestroyedQueue and removes them from their scene layer.
+        Their colliders are unregistered from the collision manager in a single pass.
+
+        Removal swaps the last object of the layer into the destroyed object's slot, so it doesn't
+        depend on the size of the scene. Handles to objects that already left the scene are stale and skipped.
  */
 void GameManager::DestroyDeactivatedGameObjects()
 {
-    for (const auto& goIterator : _toBeDestroyedQueue)
+    if (_toBeDestroyedQueue.empty())
+        return;
+
+    std::pmr::vector<ColliderInterface*> colliders(&FrameArena::GetInstance());
+    for (const SceneHandle& handle : _toBeDestroyedQueue)
+    {
+        std::shared_ptr<GameObject>* gameObject = _sceneLayers[handle._Layer].Get(handle._Slot);
+        if (gameObject != nullptr && (*gameObject)->GetCollider() != nullptr)
+            colliders.push_back((*gameObject)->GetCollider());
+    }
+    _collisionManager->RemoveColliders(colliders);
+
+    for (const SceneHandle& handle : _toBeDestroyedQueue)
+    {
+        SlotMap<std::shared_ptr<GameObject>>& sceneLayer = _sceneLayers[handle._Layer];
+        std::shared_ptr<GameObject>* gameObject = sceneLayer.Get(handle._Slot);
+        if (gameObject == nullptr) //Already removed. Destroyed more than once in the same frame
+            continue;
+
+        (*gameObject)->DetachComponents(_sceneComponents);
+        (*gameObject)->SetSceneSlot(-1, SlotHandle());
+        sceneLayer.Erase(handle._Slot); //Releases the destroyed object, unless a pool is holding on to it
+    }
+
+    _toBeDestroyedQueue.clear();
+}
+
+/*
+    Description:
+        Moves the GameObjects spawned since the last call into their scene layers, attaches their components
+        and registers their colliders with the collision manager in a single pass.
+ */
+void GameManager::AddQueuedGameObjects()
+{
+    if (_toBeAddedQueue.empty())
+        return;
+
+    std::pmr::vector<ColliderInterface*> colliders(&FrameArena::GetInstance());
+    for (std::shared_ptr<GameObject>& gameObject : _toBeAddedQueue)
     {
-        ColliderInterface* associatedCollider = (*goIterator)->GetCollider();
-        if (associatedCollider != nullptr)
-            _collisionManager->RemoveCollider(associatedCollider);
-        _gameObjects.erase(goIterator);
+        int layer = static_cast<int>(RenderingLayer::LEVEL);
+        if (gameObject->GetGraphicsController() != nullptr)
+            layer = static_cast<int>(gameObject->GetGraphicsController()->GetRenderingLayer());
+
+        gameObject->SetSceneSlot(layer, _sceneLayers[layer].Insert(gameObject));
+        gameObject->AttachComponents(_sceneComponents);
+
+        ColliderInterface* collider = gameObject->GetCollider();
+        if (collider != nullptr)
+            colliders.push_back(collider);
     }
 
+    _collisionManager->AddCollider(colliders);
+    _toBeAddedQueue.clear();
+}
+
+void GameManager::ClearScene()
+{
+    for (SlotMap<std::shared_ptr<GameObject>>& sceneLayer : _sceneLayers)
+        sceneLayer.Clear();
+    _sceneComponents.Clear();
+
+    _toBeAddedQueue.clear();
     _toBeDestroyedQueue.clear();
 }
 
 
+/*
+    Description:
+        Snapshots the pose of the Player and every Game Object before they are simulated.
+        Render blends from these poses to the newly simulated ones.
+ */
+void GameManager::StorePreviousPoses()
+{
+    _player->StorePreviousPose();
+
+    for (const SlotMap<std::shared_ptr<GameObject>>& sceneLayer : _sceneLayers)
+    {
+        for (const std::shared_ptr<GameObject>& gameObject : sceneLayer)
+            gameObject->StorePreviousPose();
+    }
+}
+
 void GameManager::Update(const InputState& inputState)
 {
+    ProfileZone updateZone("Update");
+
+    FrameArena::GetInstance().Reset();
+
+    SimulationClock::Advance();
+    Stats::GetInstance().Increment(StatCounter::TICKS_SIMULATED);
+
     /* Clear off Game Objects that were destroyed last frame */
-    DestroyDeactivatedGameObjects();
+    {
+        ProfileZone zone("Update/Destroy");
+        _discardedQueue.clear();
+        DestroyDeactivatedGameObjects();
+        StorePreviousPoses();
+    }
 
     /* Simulate Collisions amongst all Game Objects so that the can respond during their Update calls */
-    _collisionManager->SimulateCurrentCollisions();
+    {
+        ProfileZone zone("Update/Collisions");
+        _collisionManager->SimulateCurrentCollisions();
+    }
 
     /* Update the level, camera, player, and all active Game Objects on the scene */
-    _levelManager->Update();
-    _camera->Update(_player->GetTransform()->GetOrigin());
+    {
+        ProfileZone zone("Update/Level");
+        _levelManager->Update();
+        _camera->Update(_player->GetTransform()->GetOrigin());
+    }
+
     InputState worldCoordinateAdjustedInputState = inputState;
     worldCoordinateAdjustedInputState._CursorPosition = worldCoordinateAdjustedInputState._CursorPosition + _camera->GetPosition(); //Adjust the cursor position with the latest camera info
-    const PlayerInfo pInfo = _player->Update(worldCoordinateAdjustedInputState);
+    PlayerInfo pInfo;
+    {
+        ProfileZone zone("Update/Player");
+        pInfo = _player->Update(worldCoordinateAdjustedInputState);
+    }
+
+    //Objects spawned by the level and player are updated this tick. Indexed because a GAME_OVER event clears the scene mid walk
+    {
+        ProfileZone zone("Update/GameObjects");
+        AddQueuedGameObjects();
+        for (SlotMap<std::shared_ptr<GameObject>>& sceneLayer : _sceneLayers)
+        {
+            for (size_t i = 0; i < sceneLayer.Size(); i++)
+            {
+                if (sceneLayer[i]->GetActive())
+                    sceneLayer[i]->Update(pInfo, _camera->GetPosition(), worldCoordinateAdjustedInputState);
+            }
+        }
+    }
+
+    //Objects spawned by other objects start moving this tick and get their first Update next tick
+    {
+        ProfileZone zone("Update/Components");
+        AddQueuedGameObjects();
+        _sceneComponents.Update();
+    }
 
-    for (auto goIterator = _gameObjects.begin(); goIterator != _gameObjects.end(); ++goIterator)
     {
-        if ((*goIterator)->GetActive())
-            (*goIterator)->Update(pInfo, _camera->GetPosition(), worldCoordinateAdjustedInputState);
+        ProfileZone zone("Update/Particles");
+        _particleSystem->Update();
     }
 
+    for (int layer = 0; layer < RENDERING_LAYER_COUNT; layer++)
+        Stats::GetInstance().SetLiveGameObjects(static_cast<RenderingLayer>(layer), static_cast<int>(_sceneLayers[layer].Size()));
+
     if (inputState._RestartPressed)
         RestartLevel();
 }
@@ -180,71 +394,112 @@ void GameManager::Update(const InputState& inputState)
     Description:
         Renders all Game Objects and other relevant components in the level.
         Draws in RenderLayer order so that the higher Layers are drawn first.
+
+    Arguments:
+        interpolation - How far between the previous and current simulation tick to draw moving objects.
+                        0 is the state before the last Update, 1 is the latest state
  */
-void GameManager::Render()
+void GameManager::Render(const float& interpolation)
 {
+    ProfileZone renderZone("Render");
+
+    FrameArena::GetInstance().Reset();
+
+    _renderer->SetInterpolation(interpolation);
     _renderer->ClearScreen();
 
     _renderer->Render(_levelManager->GetCurrentLevelTransform(), _levelManager->GetCurrentLevelGraphicsController());
 
-    bool playerDrawn = false;
-    for (auto it = _gameObjects.rbegin(); it != _gameObjects.rend(); it++)
+    //Higher layers are drawn first. Within a layer, particles are drawn on top of the GameObjects
+    for (int layer = RENDERING_LAYER_COUNT - 1; layer >= 0; layer--)
     {
-        const bool shouldDrawnPlayerNow = (*it)->GetGraphicsController()->GetRenderingLayer() < RenderingLayer::PLAYER && !_gameOver && !playerDrawn;
-        if (shouldDrawnPlayerNow)
+        for (const std::shared_ptr<GameObject>& gameObject : _sceneLayers[layer])
         {
-            _renderer->Render(_player->GetTransform(), _player->GetGraphicsController());
-            playerDrawn = true;
+            auto graphicsController = gameObject->GetGraphicsController();
+            if (graphicsController != nullptr && graphicsController->IsActive())
+                _renderer->Render(gameObject->GetTransform(), graphicsController);
         }
 
-        auto graphicsController = (*it)->GetGraphicsController();
-        if (graphicsController != nullptr && graphicsController->IsActive())
-        {
-            _renderer->Render((*it)->GetTransform(), graphicsController);
-        }
+        if (layer == static_cast<int>(RenderingLayer::PLAYER) && !_gameOver)
+            _renderer->Render(_player->GetTransform(), _player->GetGraphicsController());
+
+        _particleSystem->Render(*_renderer, static_cast<RenderingLayer>(layer));
     }
 
-    if (!_gameOver && !playerDrawn)
-        _renderer->Render(_player->GetTransform(), _player->GetGraphicsController());
+    if (_profilerOverlay)
+        RenderProfilerOverlay();
 
     _renderer->SwapFrameBuffers();
 }
 
 /*
     Description:
-        Adds a new gameObject to the _gameObjects array.
-        _gameObjects is sorted by RenderLayer so this function tries to maintain that sort.
+        Draws the profiler's rolling zone timings over the screen, one row per zone in alphabetical order.
+        The bar is the average time and the tick past it is the worst time over the last second.
+        The vertical line marks a full simulation tick (1000 / DESIRED_UPDATES_PER_SECOND ms).
+        Timings are refreshed 4 times a second, so the overlay barely shows up in the numbers it draws.
+ */
+void GameManager::RenderProfilerOverlay()
+{
+    const float pixelsPerMillisecond = 40;
+    const float rowHeight = 12, barHeight = 8;
+    const Vector2 overlayOrigin(20, 20);
+    const Vector2 screenOrigin = _camera->GetPosition(); //Debug lines are drawn in camera space relative to this
+
+    const Uint64 now = SDL_GetPerformanceCounter();
+    if (now - _profilerSummariesRefreshed >= SDL_GetPerformanceFrequency() / 4)
+    {
+        _profilerSummaries = Profiler::GetInstance().GetZoneSummaries(1.0);
+        _profilerSummariesRefreshed = now;
+    }
+
+    const std::vector<Profiler::ZoneSummary>& summaries = _profilerSummaries;
+    for (int i = 0; i < summaries.size(); i++)
+    {
+        const Vector2 rowOrigin = overlayOrigin + Vector2(0, rowHeight * i);
+        const float average = summaries.at(i)._AverageMilliseconds * pixelsPerMillisecond;
+        const float worst = summaries.at(i)._WorstMilliseconds * pixelsPerMillisecond;
+
+        _renderer->Render({ rowOrigin, rowOrigin + Vector2(average, 0), rowOrigin + Vector2(average, barHeight), rowOrigin + Vector2(0, barHeight) }, screenOrigin);
+        _renderer->Render({ rowOrigin + Vector2(worst, 0), rowOrigin + Vector2(worst, barHeight) }, screenOrigin);
+    }
+
+    const float tickBudget = 1000.0f / DESIRED_UPDATES_PER_SECOND * pixelsPerMillisecond;
+    const float overlayHeight = std::max<float>(rowHeight * summaries.size(), rowHeight);
+    _renderer->Render({ overlayOrigin + Vector2(tickBudget, -4), overlayOrigin + Vector2(tickBudget, overlayHeight) }, screenOrigin);
+}
+
+/*
+    Description:
+        Queues a new gameObject to be appended to the end of the scene bucket for its RenderLayer. Objects without
+        graphics are kept with the Level layer. Spawns are applied in batches between update phases, so the layers
+        and the collision manager never change while they're being walked.
 
-        Attaches the usual GameObject observers and connects the object to the collision manager if
-        it has a collider.
+        Attaches the usual GameObject observers right away, so events sent before the object is placed
+        (such as a Projectile being fired) are still heard.
 
     Arguments:
 		gameObject - The gameObject being passed over to the GameManager to manage
  */
 void GameManager::AddGameObjectToScene(std::shared_ptr<GameObject> gameObject)
 {
-    auto newObjectIt = _gameObjects.end();
-    if (gameObject->GetGraphicsController() != nullptr)
-    {
-        for (auto it = _gameObjects.begin(); it != _gameObjects.end(); it++)
-        {
-            const int renderLayer = static_cast<int>(gameObject->GetGraphicsController()->GetRenderingLayer());
-            const int iteratorRenderLayer = static_cast<int>((*it)->GetGraphicsController()->GetRenderingLayer());
-            if (renderLayer <= iteratorRenderLayer)
-            {
-                newObjectIt = it;
-                break;
-            }
-        }
-    }
+    gameObject->AddObserver(this);
+    gameObject->AddObserver(_soundManager.get());
+    _toBeAddedQueue.push_back(std::move(gameObject));
+}
 
-    newObjectIt = _gameObjects.insert(newObjectIt, gameObject);
-    gameObject->AddObserver(this, newObjectIt);
-    gameObject->AddObserver(_soundManager.get(), newObjectIt);
+/*
+    Description:
+        Particles skip the GameObject scene entirely. They're pooled in their emitter and updated and drawn by the ParticleSystem
 
-    ColliderInterface* collider = gameObject->GetCollider();
-    if (collider != nullptr)
-        _collisionManager->AddCollider(collider);
+    Arguments:
+        emitter - The pool of the particle prototype being spawned
+        position - Where to spawn the particle in world coordinates
+        direction - Where the particle is facing
+ */
+void GameManager::AddParticleToScene(const std::shared_ptr<ParticleEmitter>& emitter, const Vector2& position, const Vector2& direction)
+{
+    _particleSystem->Spawn(emitter, position, direction);
 }
 
 void GameManager::Notify(const GameObjectEvent& eventType, const bool begin)
@@ -255,11 +510,27 @@ void GameManager::Notify(const GameObjectEvent& eventType, const bool begin)
     }
 }
 
-void GameManager::Notify(const GameObjectEvent& eventType, const std::list<std::shared_ptr<GameObject>>::iterator& objectId)
+void GameManager::Notify(const GameObjectEvent& eventType, GameObject* gameObject)
 {
     if (eventType == GameObjectEvent::DESTROYED)
     {
-        _toBeDestroyedQueue.push_back(objectId);
+        SceneHandle handle;
+        handle._Layer = gameObject->GetSceneLayer();
+        handle._Slot = gameObject->GetSceneHandle();
+        if (handle._Layer >= 0)
+            _toBeDestroyedQueue.push_back(handle);
+        else //Destroyed before it was ever placed
+        {
+            const auto queued = std::find_if(_toBeAddedQueue.begin(), _toBeAddedQueue.end(),
+                [gameObject](const std::shared_ptr<GameObject>& queuedObject) { return queuedObject.get() == gameObject; });
+
+            //The object is still notifying its observers, so it is kept alive until the next Update instead of being freed here
+            if (queued != _toBeAddedQueue.end())
+            {
+                _discardedQueue.push_back(std::move(*queued));
+                _toBeAddedQueue.erase(queued);
+            }
+        }
     }
     else
     {
@@ -18,3 +18,8 @@ GameObject::GameObject(const GameObject& source)
 	_transform = std::make_shared<Transform>();
 	*_transform = *source._transform;
 }
+
+void GameObject::StorePreviousPose()
+{
+	_transform->StorePreviousPose();
+}
\ No newline at end of file
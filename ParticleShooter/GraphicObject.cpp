@@ -1,6 +1,7 @@
 #include "GraphicObject.h"
 #include "GameObjectRegistryLocator.h"
 #include "GameObjectRegistryService.h"
+#include "GraphicAssetInfo.h"
 #include "TimedDestructionController.h"
 #include "Transform.h"
 
@@ -18,6 +19,9 @@ GraphicObject::GraphicObject(const GraphicAssetInfo& media, const float& deathTi
 	_graphicsController = std::make_shared<AnimatedSingleTextureGraphicsController>(&_propertyController, media);
 	_destructionController = std::make_unique<TimedDestructionController>(_observerController, deathTime);
 	SetIsActive(false);
+
+	if (media.IsParticle()) //Shares the already loaded animation with the emitter
+		_particleEmitter = std::make_shared<ParticleEmitter>(_graphicsController->GetCurrentAnimation(), media._RenderingLayer, deathTime);
 }
 
 GraphicObject::GraphicObject(const GraphicObject& source) : GameObject(source)
@@ -28,6 +32,7 @@ GraphicObject::GraphicObject(const GraphicObject& source) : GameObject(source)
 	*_graphicsController = *source._graphicsController;
 	*_destructionController = *source._destructionController;
 	_originalPosition = source._originalPosition;
+	_sceneComponents = source._sceneComponents;
 }
 
 GraphicObject::~GraphicObject()
@@ -62,20 +67,53 @@ void GraphicObject::SetPosition(const Vector2& position)
 	_originalPosition = position;
 }
 
+/*
+	Description:
+		Counts down to destruction and advances the animation, unless those components were attached to SceneComponents.
+*/
 void GraphicObject::Update(const PlayerInfo& playerInfo, const Vector2& cameraPosition, const InputState& input)
 {
-	if (_destructionController->TimeIsUp())
+	if (!(_sceneComponents & SceneComponents::LIFETIME) && _destructionController->TimeIsUp())
 		return;
 
 	//Graphic Objects on the UI Rendering Layer should always adjust to the camera's current position for the upcoming view transformation to camera space 
 	if (_graphicsController->GetRenderingLayer() == RenderingLayer::UI)
 		_transform->SetOrigin(_originalPosition + cameraPosition);
 
-	_graphicsController->Update();
+	if (!(_sceneComponents & SceneComponents::ANIMATION))
+		_graphicsController->Update();
 }
 
+void GraphicObject::AttachComponents(SceneComponents& components)
+{
+	if (_sceneComponents != 0)
+		_componentHandles = components.Attach(*this, _sceneComponents, *_transform, *_graphicsController, *_destructionController);
+}
+
+void GraphicObject::DetachComponents(SceneComponents& components)
+{
+	components.Detach(_componentHandles);
+	_componentHandles = SceneComponents::Handles();
+}
+
+/*
+	Description:
+		Spawns a copy of prototype into the scene. Particle prototypes are spawned into their pooled ParticleEmitter,
+		everything else is cloned into a new GameObject.
+
+	Arguments:
+		prototype - The object to copy
+		position - Where to spawn in world coordinates
+		direction - Where the spawned object is facing. Defaults to up (0, -1)
+*/
 void SpawnGraphicObject(const GraphicObject& prototype, const Vector2& position, const Vector2& direction)
 {
+	if (prototype.GetParticleEmitter() != nullptr)
+	{
+		GameObjectRegistryLocator::GetCreatorService()->AddParticleToScene(prototype.GetParticleEmitter(), position, direction);
+		return;
+	}
+
 	const std::shared_ptr<GraphicObject> clone = prototype.Clone(position, direction);
 	GameObjectRegistryLocator::GetCreatorService()->AddGameObjectToScene(clone);
 }
\ No newline at end of file
@@ -25,10 +25,12 @@ public:
 	void operator=(const AnimatedSingleTextureGraphicsController& source);
 
 	void Update() override;
-	std::vector<std::shared_ptr<const Texture>> GetCurrentTextures() const override;
+	Span<const Texture* const> GetCurrentTextures() const override;
+	std::shared_ptr<const Animation> GetCurrentAnimation() const { return _animator->GetCurrentAnimation(); }
 
 	void SetCurrentAnimation(std::shared_ptr<const Animation> animation);
 	void SetAnimationFramePercent(const float& percent);
+	void RestartAnimation(); //Back to the first frame of the starting animation
 
 private:
 	std::unique_ptr<Animator> _animator = nullptr; //A single animator for the single texture
@@ -13,6 +13,7 @@
 #include "Transition.h"
 #include "PropertyController.h"
 
+#include <cstdint>
 #include <vector>
 #include <memory>
 
@@ -33,6 +34,7 @@ public:
 	void AddTransition(const Property& propertyId, const int& value, const std::shared_ptr<const Animation>& destination);
 
 	std::shared_ptr<const Animation> GetNextAnimation(const int& frameIndex, const PropertyController* propertyController) const;
+	bool CanTransition(const int& frameIndex) const { return _looping || frameIndex >= static_cast<int>(_frames.size()) - 1; } //Non-looping animations don't transition until all of their frames have played
 
 	/* Getters */
 	bool IsTimerBased() const { return _timerBased; } //Whether an the Animation progresses over time or when told to do so
@@ -48,6 +50,25 @@ private:
 	float _speed = 1.0f;
 	SDL_RendererFlip _flipType = SDL_FLIP_NONE;
 
+	//One expected value of a compiled transition
+	struct CompiledCondition
+	{
+		int _Property = 0; //Index into the PropertyController's values
+		int _Value = 0;
+	};
+
+	//A Transition flattened for evaluation. Its conditions are a contiguous run of _compiledConditions
+	struct CompiledTransition
+	{
+		std::uint32_t _PropertyMask = 0; //Bit per Property the conditions read. All of them must be assigned
+		int _FirstCondition = 0;
+		int _ConditionCount = 0;
+	};
+
+	void CompileTransitions();
+
 	std::vector<std::shared_ptr<Texture>> _frames;
 	std::vector<Transition> _transitions;
+	std::vector<CompiledTransition> _compiledTransitions; //Parallel to _transitions
+	std::vector<CompiledCondition> _compiledConditions;
 };
@@ -10,6 +10,8 @@
 
 #include "Animation.h"
 
+#include <cstdint>
+
 /*
 	Animation controller of sorts. Keeps track of the current animation and which frame within that animation should be active.
 	The connective tissue between the GraphicsController (which renders the animation) and the Animations themselves
@@ -24,11 +26,15 @@ public:
 	void Update();
 	void Play() const;
 	void Stop() const;
+	void Restart();
 
 	void SetCurrentAnimation(const std::shared_ptr<const Animation>& animation);
 	void SetAnimationFramePercent(const float& percent) const; //0% is the first frame. 100% is the last frame
 
 	std::shared_ptr<Texture> GetCurrentFrame() const { return _currentAnim->GetCurrentFrame(_frameIndex); }
+	std::shared_ptr<const Animation> GetCurrentAnimation() const { return _currentAnim; }
+
+	static const int TIME_PER_FRAME = 200; //How many MS are spent on each frame at an animation speed of 1.0
 
 private:
 	void TransitionToNextAnimationIfNeeded();
@@ -37,8 +43,8 @@ private:
 	std::shared_ptr<const Animation> _currentAnim = nullptr; 
 	std::shared_ptr<const Animation> _startingAnim = nullptr;
 	PropertyController* _propertyController = nullptr; //Associated set of properties which dictates animation transitions
-
-	const int _timePerFrame = 200; //How many MS are spent on each frame
+	std::uint32_t _checkedVersion = 0; //_propertyController's version when the transitions were last checked
+	bool _transitionsChecked = false; //Whether the current animation's transitions have been checked against _checkedVersion
 
 	/* These properties are mutable because an Animation should be able to play while being const */
 	mutable int _frameIndex = 0; //Current frame that the animator is working with within the current animation (_currentAnim)
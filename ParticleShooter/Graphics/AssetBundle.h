@@ -0,0 +1,80 @@
+//
+//  AssetBundle.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/*
+	A single packed file holding every png found under the asset directory. Each image is stored already decoded
+	into the renderer's native pixel format with the cyan color key baked into the alpha channel.
+
+	At runtime the bundle is memory mapped and its index (sorted by file path) is searched in place, so
+	Textures can be created straight from the mapped pixels without opening, inflating or converting any pngs.
+	Built offline by AssetBundle::Build (launch the game with --bundle-assets).
+*/
+class AssetBundle
+{
+public:
+	//An entry in the bundle's index. The layout matches the bytes on disk
+	struct Image
+	{
+		char _FilePath[116]; //Null terminated path of the original png, relative to the working directory ("Assets/UI/Loading_0.png")
+		uint32_t _Width = 0;
+		uint32_t _Height = 0;
+		uint32_t _Pitch = 0; //Number of bytes in a single row of pixels
+		uint64_t _PixelOffset = 0; //Number of bytes from the start of the bundle to the image's first pixel
+	};
+
+	static AssetBundle& GetInstance();
+
+	bool Open(const std::string& bundlePath);
+	void Close();
+
+	const Image* FindImage(const std::string& filePath) const;
+	const void* GetPixels(const Image& image) const { return _mappedData + image._PixelOffset; }
+
+	/* Getters */
+	bool IsOpen() const { return _mappedData != nullptr; }
+	uint32_t GetPixelFormat() const;
+
+	static bool Build(const std::string& assetDirectory, const std::string& bundlePath);
+
+private:
+	//The first bytes of every bundle. Immediately followed by _ImageCount Image entries
+	struct Header
+	{
+		char _Magic[4];
+		uint32_t _Version = 0;
+		uint32_t _ImageCount = 0;
+		uint32_t _PixelFormat = 0; //The SDL_PixelFormatEnum every image in the bundle is stored in
+	};
+
+	AssetBundle() = default;
+	~AssetBundle();
+	AssetBundle(const AssetBundle&);
+	void operator=(const AssetBundle&);
+
+	bool MapFile(const std::string& bundlePath);
+	void UnmapFile();
+
+	const uint8_t* _mappedData = nullptr; //Start of the memory mapped bundle file. nullptr while no bundle is open
+	size_t _mappedSize = 0;
+
+	const Header* _header = nullptr;
+	const Image* _images = nullptr; //Sorted by _FilePath so lookups can binary search the mapped index directly
+
+#ifdef _WIN32
+	void* _fileHandle = nullptr;
+	void* _fileMappingHandle = nullptr;
+#else
+	int _fileDescriptor = -1;
+#endif
+};
@@ -0,0 +1,47 @@
+//
+//  BackgroundCompositor.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include <SDL.h>
+#include <string>
+#include <vector>
+
+class MultiTextureGraphicsController;
+
+/*
+	Flattens stacked, unanimated background layers into a grid of pre-composited tiles.
+
+	Consecutive layers that share a parallax factor always move together, so they are blended into a single image once at
+	load time and cut into tiles. Each frame then draws one tile per screen region instead of every overlapping layer,
+	and the Renderer skips the tiles that are off screen. Layers are never merged across a different parallax factor
+	since that would change the draw order.
+*/
+class BackgroundCompositor final
+{
+public:
+	BackgroundCompositor(const int& tileSize = 512);
+
+	void AddLayer(const std::string& filePath, const int& xOffset = 0, const int& yOffset = 0, const float& parallax = 1.0);
+	void Composite(MultiTextureGraphicsController& graphicsController) const;
+
+private:
+	//A single png placed in the background. Drawn in the order layers were added
+	struct Layer
+	{
+		std::string _FilePath;
+		SDL_Rect _Bounds; //Position relative to the background's origin. Width and height are filled in once the png is loaded
+		float _Parallax = 1.0;
+	};
+
+	void CompositeGroup(const size_t& first, const size_t& last, MultiTextureGraphicsController& graphicsController) const;
+	static SDL_Surface* LoadSurface(const std::string& filePath);
+
+	std::vector<Layer> _layers;
+	int _tileSize = 512; //Width and height of each composited tile in pixels
+};
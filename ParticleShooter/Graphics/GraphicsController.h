@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Common.h"
+#include "Span.h"
 #include "Texture.h"
 
 #include <memory>
@@ -22,7 +23,7 @@ class GraphicsController
 {
 public:
 	virtual void Update() = 0; //How GraphicsControllers progress their graphics over the course of the game (for instance, telling the animator to update frames)
-	virtual std::vector<std::shared_ptr<const Texture>> GetCurrentTextures() const = 0; //Returns the textures that the renderer needs to draw
+	virtual Span<const Texture* const> GetCurrentTextures() const = 0; //Returns the textures that the renderer needs to draw. Only valid until the FrameArena is Reset
 
 	virtual bool IsActive() const { return _isActive; } //Whether or not the GC should be rendered
 	virtual void SetIsActive(const bool& active) { _isActive = active; }
@@ -28,7 +28,8 @@ public:
 	void Update() override {}
 
 	void AddTexture(const std::string& filePath, const int& xOffset = 0, const int& yOffset = 0, const float& parallax = 1.0, const float& scaleFactor = 1.0);
-	std::vector<std::shared_ptr<const Texture>> GetCurrentTextures() const override;
+	void AddTexture(const std::shared_ptr<const Texture>& texture) { _textures.push_back(texture); } //Offset and parallax are expected to already be set
+	Span<const Texture* const> GetCurrentTextures() const override;
 
 private:
 	std::vector<std::shared_ptr<const Texture>> _textures; //List of textures that will all be drawn when rendering this GC
@@ -0,0 +1,70 @@
+//
+//  ParticleEmitter.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include "Common.h"
+#include "Vector2.h"
+
+#include <memory>
+#include <SDL.h>
+#include <vector>
+
+class Animation;
+class Texture;
+
+/*
+	A fixed capacity pool of identical one shot particles (hit sparks, explosion debris, ...).
+
+	Particles never collide, move or transition, so instead of a full GraphicObject each one is just a handful of values
+	stored in parallel arrays. Every particle of an emitter shares the same animation and lifetime, which means they
+	expire in the order they were spawned. The pool is a ring buffer: live particles are the _count entries starting at _head.
+	Spawning into a full pool recycles the oldest particle.
+*/
+class ParticleEmitter final
+{
+public:
+	ParticleEmitter(const std::shared_ptr<const Animation>& animation, const RenderingLayer& layer, const float& lifetime, const int& capacity = 128);
+
+	void Spawn(const Vector2& position, const Vector2& direction);
+	void Update();
+	void Clear();
+
+	/* Getters */
+	RenderingLayer GetRenderingLayer() const { return _renderingLayer; }
+	int GetCount() const { return _count; }
+	int GetCapacity() const { return _capacity; }
+	int GetIndex(const int& i) const { return (_head + i) % _capacity; } //Pool index of the i-th oldest live particle
+	Vector2 GetPosition(const int& index) const { return _positions[index]; }
+	double GetAngle(const int& index) const { return _angles[index]; }
+	const Texture* GetFrame(const int& index) const { return _frameTextures[_frames[index]]; }
+	bool IsRegistered() const { return _registered; }
+
+	/* Setters */
+	void SetIsRegistered(const bool registered) { _registered = registered; } //Whether or not a ParticleSystem is already updating and rendering this emitter
+
+private:
+	std::shared_ptr<const Animation> _animation = nullptr; //Keeps the frame textures alive
+	std::vector<const Texture*> _frameTextures; //Resolved once up front so rendering never touches shared_ptr ref counts
+	RenderingLayer _renderingLayer = RenderingLayer::PARTICLES;
+	Uint32 _frameDuration = 0; //How many MS each frame is displayed for. Mirrors Animator
+	Uint32 _lifetime = 0; //How many MS a particle lives for. Never longer than a single play through of the animation
+
+	/* Particle Pool. One entry per particle in each array */
+	std::vector<Vector2> _positions; //World space position
+	std::vector<double> _angles; //Clockwise orientation in degrees
+	std::vector<int> _frames; //Index into _frameTextures
+	std::vector<Uint32> _frameStartTimes; //When the current frame started displaying
+	std::vector<Uint32> _spawnTimes; //When the particle was spawned. Its age is measured from here
+
+	int _capacity = 0;
+	int _head = 0; //Pool index of the oldest live particle
+	int _count = 0; //Number of live particles
+
+	bool _registered = false;
+};
@@ -0,0 +1,42 @@
+//
+//  ParticleSystem.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include "Common.h"
+#include "ParticleEmitter.h"
+
+#include <memory>
+#include <vector>
+
+class Renderer;
+
+/*
+	Updates and renders every ParticleEmitter that has had particles spawned into it.
+	Emitters are owned by the prototypes they were created for and registered here the first time they are used,
+	so the game's particles live outside of the GameObject list entirely.
+*/
+class ParticleSystem final
+{
+public:
+	ParticleSystem() = default;
+	~ParticleSystem();
+
+	void Spawn(const std::shared_ptr<ParticleEmitter>& emitter, const Vector2& position, const Vector2& direction);
+	void Update();
+	void Render(Renderer& renderer, const RenderingLayer& renderingLayer) const;
+	void Clear();
+
+	/* Setters */
+	void SetSpawnRate(const float& spawnRate) { _spawnRate = spawnRate; } //Fraction of spawn requests that produce a particle. Lowered by the FrameGovernor
+
+private:
+	std::vector<std::shared_ptr<ParticleEmitter>> _emitters; //Every emitter that has been spawned into
+	float _spawnRate = 1.0f;
+	float _spawnCredit = 0.0f; //Accumulates _spawnRate per request. A particle is spawned each time it reaches 1, so skipping is even and needs no randomness
+};
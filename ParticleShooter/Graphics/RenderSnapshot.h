@@ -0,0 +1,47 @@
+//
+//  RenderSnapshot.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include <SDL.h>
+#include <vector>
+
+//Everything the render thread needs to draw a single texture. Already resolved into camera space
+struct SpriteCommand
+{
+	SDL_Texture* _Texture = nullptr;
+	SDL_Rect _SourceRect; //The model space bounding rect
+	SDL_Rect _DestinationRect; //The camera space bounding rect
+	double _Angle = 0.0; //Clockwise rotation in degrees
+	SDL_Point _RotationCenter; //The model space point where the texture is rotated
+	SDL_RendererFlip _Flip = SDL_RendererFlip::SDL_FLIP_NONE;
+};
+
+//A single debug line in camera space. Drawn in red on top of the sprites
+struct LineCommand
+{
+	SDL_Point _Start;
+	SDL_Point _End;
+};
+
+/*
+	An immutable (once submitted) description of a single frame. The simulation records draw commands into a snapshot
+	and hands it off to the RenderThread, which owns the SDL_Renderer and does the actual drawing and presenting.
+	Commands are drawn in the order they were recorded.
+*/
+struct RenderSnapshot
+{
+	void Clear()
+	{
+		_Sprites.clear();
+		_Lines.clear();
+	}
+
+	std::vector<SpriteCommand> _Sprites;
+	std::vector<LineCommand> _Lines;
+};
@@ -0,0 +1,91 @@
+//
+//  RenderThread.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include "Common.h"
+#include "RenderSnapshot.h"
+
+#include <array>
+#include <condition_variable>
+#include <mutex>
+#include <SDL.h>
+#include <thread>
+#include <vector>
+
+/*
+	Owns the SDL_Renderer on a dedicated thread so that presenting (which blocks on vsync) overlaps with simulation.
+
+	Frames are handed over through a triple buffer of RenderSnapshots. The simulation always has a snapshot to record into,
+	and the render thread always draws the most recently submitted one. Stale snapshots are simply skipped.
+
+	SDL_Textures can only be touched by the thread that owns the SDL_Renderer. Creation requests block the caller until the
+	render thread has made the texture. Destruction is deferred until the snapshot that may still reference it has been drawn.
+
+	With the SOFTWARE backend, frames are rasterized into an offscreen surface instead of a window and presenting never waits on vsync.
+*/
+class RenderThread final
+{
+public:
+	RenderThread(SDL_Window* window, const RenderingBackend& backend = RenderingBackend::ACCELERATED);
+	~RenderThread();
+
+	bool Start();
+
+	/* Simulation Thread */
+	RenderSnapshot& BeginSnapshot(); //The snapshot to record the next frame into. Only valid until SubmitSnapshot
+	void SubmitSnapshot(); //Publishes the recorded snapshot as the next frame to draw
+
+	/* Any Thread */
+	SDL_Texture* CreateTexture(SDL_Surface* surface);
+	SDL_Texture* CreateTexture(const void* pixels, const int width, const int height, const int pitch, const Uint32 pixelFormat);
+	void DestroyTexture(SDL_Texture* texture);
+
+private:
+	//A pending texture creation. Lives on the requesting thread's stack until _Completed
+	struct TextureRequest
+	{
+		SDL_Surface* _Surface = nullptr; //Either a surface or raw pixels are uploaded
+		const void* _Pixels = nullptr;
+		int _Width = 0;
+		int _Height = 0;
+		int _Pitch = 0;
+		Uint32 _PixelFormat = 0;
+
+		SDL_Texture* _Result = nullptr;
+		bool _Completed = false;
+	};
+
+	void Run();
+	SDL_Renderer* CreateSDLRenderer();
+	SDL_Texture* SubmitTextureRequest(TextureRequest& request);
+	void ProcessTextureRequests(std::vector<TextureRequest*>& requests);
+	void Draw(const RenderSnapshot& snapshot);
+
+	SDL_Window* _sdlWindow = nullptr; //Created and polled by the main thread. nullptr for the SOFTWARE backend
+	RenderingBackend _backend = RenderingBackend::ACCELERATED;
+	SDL_Surface* _offscreenSurface = nullptr; //The SOFTWARE backend's render target. Only ever touched by the render thread
+	SDL_Renderer* _sdlRenderer = nullptr; //Only ever touched by the render thread
+
+	std::thread _thread;
+	std::mutex _mutex; //Guards everything below
+	std::condition_variable _workAvailable; //Wakes the render thread for new snapshots, texture requests or shutdown
+	std::condition_variable _workCompleted; //Wakes threads waiting on start up or texture requests
+
+	std::array<RenderSnapshot, 3> _snapshots;
+	int _writeIndex = 0; //Being recorded by the simulation
+	int _readyIndex = 1; //The latest submitted snapshot waiting to be drawn
+	int _readIndex = 2; //Being drawn by the render thread
+	bool _snapshotReady = false;
+
+	std::vector<TextureRequest*> _textureRequests;
+	std::vector<SDL_Texture*> _texturesToDestroy;
+
+	bool _running = false;
+	bool _started = false; //The render thread finished its start up (successfully or not)
+};
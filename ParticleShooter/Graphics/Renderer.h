@@ -8,6 +8,11 @@
 
 #pragma once
 
+#include "Common.h"
+#include "ParticleEmitter.h"
+#include "Random.h"
+#include "RenderSnapshot.h"
+#include "RenderThread.h"
 #include "Texture.h"
 #include "ScrollingCamera.h"
 
@@ -18,50 +23,75 @@ class GraphicsController;
 class GraphicObject;
 class Transform;
 struct SDL_Window;
-struct SDL_Renderer;
 
 /*
 	Wrapper class for SDL_Renderer. Manages all of the game's rendering needs including:
 	 - Creating new SDL_Textures
 	 - Screen Effects
 	 - Drawing Textures to the Screen
+
+	Drawing is recorded into a RenderSnapshot between ClearScreen and SwapFrameBuffers. The snapshot is then handed to
+	the RenderThread, which owns the SDL_Renderer and presents the frame while the simulation moves on.
+
+	The RenderingBackend picks where frames end up. ACCELERATED draws to a fullscreen window, SOFTWARE rasterizes offscreen and
+	NONE (headless) records nothing but still gives Textures their dimensions, so the simulation runs exactly as it would on screen.
 */
 class Renderer final
 {
 public:
-	Renderer(std::shared_ptr<const ScrollingCamera> camera);
+	Renderer(std::shared_ptr<const ScrollingCamera> camera, const RenderingBackend& backend = RenderingBackend::ACCELERATED);
 	~Renderer();
 
 	bool Initialize();
 
 	void Render(const std::shared_ptr<const Transform>& transform, const std::shared_ptr<const GraphicsController>& graphicsController);
 	void Render(const std::vector<Vector2>& points, const Vector2& origin);
+	void Render(const ParticleEmitter& emitter);
 
 	void ClearScreen();
 	void SwapFrameBuffers();
 
 	void SetScreenShake(const bool active);
 	void SetCamera(std::shared_ptr<ScrollingCamera> camera) { _camera = camera; }
+	void SetInterpolation(const float& alpha) { _interpolation = alpha; } //How far between the previous (0) and current (1) simulation tick the next frame is drawn
+	void SetCullingMargin(const float& margin) { _cullingMargin = margin; } //Scales the padding kept around rotated sprites by IsOnScreen
+	void SetDrawParallaxLayers(const bool draw) { _drawParallaxLayers = draw; } //Whether textures with a parallax other than 1 are drawn
 
 	static bool CreateTextureFromFile(Texture& newTexture, const std::string& filePath);
+	static bool CreateTextureFromPixels(Texture& newTexture, const void* pixels, const int width, const int height, const int pitch, const Uint32 pixelFormat);
+	static void DestroyTexture(SDL_Texture* sdlTexture);
 
 private:
-	void RenderTexture(const Transform& transform, const std::shared_ptr<const Texture>& texture) const;
+	bool InitializeOffscreen();
+	void RenderTexture(const Vector2& worldSpacePosition, const double& orientationAngle, const Texture* texture) const;
 	Vector2 ConvertPointFromModelToCameraSpace(const Vector2 point, const Vector2 origin) const;
-	Vector2 CalculateCameraCoordinatesForTexture(const std::shared_ptr<const Texture>& texture, const Vector2& worldSpacePosition, const Vector2& additionalOffset = Vector2(0,0)) const;
+	Vector2 CalculateCameraCoordinatesForTexture(const Texture& texture, const Vector2& worldSpacePosition, const Vector2& additionalOffset = Vector2(0,0)) const;
 	void UpdateRenderingEffectOffset(const RenderingLayer& renderingLayer);
+	float GetLayerInterpolation(const RenderingLayer& renderingLayer) const;
+	bool IsOnScreen(const SDL_Rect& cameraSpaceRect, const double& orientationAngle) const;
 
 	SDL_Window* sdlWindow = nullptr; //The Gameplay Window as defined by SDL
-	static SDL_Renderer* SDL_RENDERER; //The Underlying Renderer that this class communicates with
+	std::unique_ptr<RenderThread> _renderThread = nullptr; //Owns the underlying SDL_Renderer. Draws and presents submitted snapshots
+	RenderSnapshot _headlessSnapshot; //Recorded into and discarded every frame by the NONE backend, or when no RenderThread could be started
+	RenderSnapshot* _snapshot = &_headlessSnapshot; //The frame currently being recorded
+	static RenderThread* RENDER_THREAD; //Where Textures are created and destroyed. Only the render thread may touch SDL_Textures
+	static RenderingBackend BACKEND; //Shared with the static Texture creation functions
 
 	std::shared_ptr<const ScrollingCamera> _camera = nullptr; //The camera which defines the "Camera Space" in which we render to
 
 	Vector2 _renderingEffectOffset; //An offset which represents how textures are shifted due to active screen effects
 
+	float _interpolation = 1.0; //Blend factor between the previous and current simulation tick. 1.0 draws the latest simulated state
+	Vector2 _cameraPosition; //The (interpolated) camera position for the layer currently being drawn
+
+	float _cullingMargin = 1.0f; //1.0 never culls a visible corner of a rotated sprite. Lower values cull sooner when under load
+	bool _drawParallaxLayers = true;
+
 	/* Screen Shake Effect */
 	int _shakeActiveCount = 0; //How many callers are currently requesting a screen shake
 	bool _screenShake = false; //Whether or not the renderer should adjust _renderingEffectOffset with a screen shake offset
 	const int _screenShakeMagnitude = 7; //How intense the screen shake is. 0 Meaning no screen shake
+	Random _screenShakeRandom; //Kept apart from the world's Random so that rendering never changes the simulation
 	
 
 };
\ No newline at end of file
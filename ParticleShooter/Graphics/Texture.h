@@ -25,6 +25,7 @@ class Texture
 {
 public:
     Texture(const std::string& filePath, const float& scaleFactor = 1.0);
+    Texture(const void* pixels, const int& width, const int& height, const int& pitch, const Uint32& pixelFormat);
     virtual ~Texture();
 
     static void LoadTextures(std::vector<std::shared_ptr<Texture>>& textures, const GraphicAssetInfo& textureInfo);
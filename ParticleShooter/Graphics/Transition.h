@@ -9,7 +9,6 @@
 #pragma once
 
 #include "GameObjectProperties.h"
-#include "PropertyController.h"
 
 #include <vector>
 #include <memory>
@@ -28,9 +27,8 @@ public:
 	void AddProperty(const std::pair<Property, int>& transitionProperty);
 	void AddProperty(const std::vector<std::pair<Property, int>>& transitionProperties);
 
-	bool ShouldTransition(const PropertyController& propertyController) const;
-
 	std::shared_ptr<const Animation> GetDestination() const { return _destination; }
+	const std::vector<std::pair<Property, int>>& GetPropertyValues() const { return _propertyValues; }
 
 private:
 	std::shared_ptr<const Animation> _destination  = nullptr; //A pointer to the destination Animation that is being transition to
@@ -19,6 +19,7 @@ HexBeam::HexBeam() : Projectile(Resources::Graphics::ENEMY_ATTACK_HEX)
 
 	_speed = 300;
 	_fireEvent = GameObjectEvent::ENEMY_SPECIAL_ATTACK;
+	_sceneComponents &= ~SceneComponents::MOTION; //Moves itself in Update without responding to collisions
 }
 
 std::shared_ptr<Projectile> HexBeam::Clone(const Vector2& position) const
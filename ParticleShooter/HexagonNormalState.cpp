@@ -2,6 +2,8 @@
 #include "HexBeam.h"
 #include "Transform.h"
 
+const double HexagonNormalState::ROTATION_PER_ATTACK = 29.2;
+
 /*
 	Description:
 		Constructs everything needed for projectile shooting. The projectile being shot (HexBeam),
@@ -98,7 +100,7 @@ void HexagonNormalState::PerformAttackBehavior(const PlayerInfo& playerInfo, Tra
 		}
 
 		_currentAngle = transform->GetOrientationAngle();
-		_nextAngle = _currentAngle + _rotationPerAttack;
+		_nextAngle = _currentAngle + ROTATION_PER_ATTACK;
 		_attackTimer.Start();
 	}
 }
@@ -22,6 +22,8 @@ public:
 	InputManager();
 	//Polls for input events and returns a pointer to the InputState struct holding the relevant results of each poll.
 	InputState PollPlayerInput();
+	//Swaps the active input type. Any state the previous controller had built up is kept until the new one changes it
+	void SetInputController(std::unique_ptr<SystemInputController> inputController);
 
 private:
 	SDL_Event _polledSDLEvent; //The current SDL event returned by the event queue. Must be processed by a SystemInputController
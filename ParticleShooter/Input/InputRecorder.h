@@ -0,0 +1,63 @@
+//
+//  InputRecorder.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include "InputState.h"
+
+#include <fstream>
+#include <SDL.h>
+#include <string>
+
+/*
+	Writes the InputState of every simulation tick to a compact binary file that ReplayInputController can play back.
+	Together with deterministic ticking and the world seed stored in the header, a replay reproduces the recorded session exactly.
+
+	Input rarely changes between ticks, so each tick is stored as a delta against the previous one:
+		Header - "PSIR", a format version byte and the little endian Uint32 world seed
+		REPEAT_FLAG | n - The previous tick's input held for n more ticks (1 to MAX_REPEAT)
+		Change mask - Any combination of the Change bits, followed by the new values in bit order:
+			BUTTONS - Uint16 with one bit per button, in InputEvent order
+			CURSOR - Two float32s
+			MOVEMENT - Two float32s
+
+	Before the first tick the previous input is a default constructed InputState. Every value is little endian.
+*/
+class InputRecorder final
+{
+public:
+	~InputRecorder();
+
+	bool Open(const std::string& filePath, const Uint32 seed);
+	void Record(const InputState& inputState);
+	void Close();
+
+	/* Getters */
+	int GetTickCount() const { return _tickCount; }
+
+	static Uint16 PackButtons(const InputState& inputState);
+	static void UnpackButtons(const Uint16 buttons, InputState& inputState);
+
+	enum Change : Uint8 { BUTTONS = 1, CURSOR = 2, MOVEMENT = 4 };
+
+	static const char* const MAGIC; //Four characters
+	static const Uint8 FORMAT_VERSION = 1;
+	static const Uint8 REPEAT_FLAG = 0x80;
+	static const int MAX_REPEAT = 0x7F;
+
+private:
+	void WriteRepeats();
+	void WriteUint16(const Uint16 value);
+	void WriteUint32(const Uint32 value);
+	void WriteVector(const Vector2& vector);
+
+	std::ofstream _file;
+	InputState _previousState; //What the next tick is compared against
+	int _pendingRepeats = 0; //Ticks identical to _previousState that haven't been written yet
+	int _tickCount = 0; //Ticks recorded since Open
+};
@@ -12,7 +12,7 @@
 
 //The Events which are associated with input data that needs to be polled.
 //Consumed by SystemInputControllers to determine how they will specifically poll an event for the system
-enum InputEvent { ACTION, BACK, START, QUIT, SHOOT, RESTART, BEAM, DIRECTION };
+enum InputEvent { ACTION, BACK, START, QUIT, SHOOT, RESTART, BEAM, DIRECTION, PROFILE_TRACE, PROFILE_OVERLAY };
 
 /*
 	An informational struct meant to represent a snapshot of input information.
@@ -28,6 +28,8 @@ struct InputState {
 	bool _ShootPressed = false;
 	bool _RestartPressed = false;
 	bool _BeamPressed = false;
+	bool _ProfileTracePressed = false; //Developer hotkey. Writes the profiler's trace
+	bool _ProfileOverlayPressed = false; //Developer hotkey. Toggles the profiler overlay
 
 	Vector2 _CursorPosition = Vector2(0, 0);
 	Vector2 _MovementDirection = Vector2(0, 0);
@@ -0,0 +1,53 @@
+//
+//  ReplayInputController.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include "SystemInputController.h"
+
+#include <string>
+#include <vector>
+
+/*
+	Plays back a recording made by InputRecorder. Every poll advances the recording by one simulation tick, so the
+	InputManager must be polled once per tick rather than once per frame while replaying.
+
+	The recorded buttons, cursor and movement replace the live ones. Escape still quits, and the replay asks to quit by
+	itself once the recording runs out. The recorded quit itself is not replayed.
+*/
+class ReplayInputController : public SystemInputController
+{
+public:
+	ReplayInputController(const std::string& filePath);
+
+	void BeginFrame() override;
+	void UpdateEventStatus(bool& eventMarker, const InputEvent& inputEvent, const SDL_Event& polledSDLEvent) override;
+	void UpdateFrameStatus(bool& eventMarker, const InputEvent& inputEvent) override;
+	void UpdateCursorPosition(Vector2& vectorMarker) override;
+	void UpdateMovementDirection(Vector2& vectorMarker) override;
+
+	/* Getters */
+	bool IsLoaded() const { return _loaded; } //False if the file was missing or isn't a recording
+	bool IsFinished() const { return _finished; }
+	Uint32 GetSeed() const { return _seed; } //The world seed the recording was made with
+
+private:
+	bool ReadTick();
+	bool Read(void* destination, const size_t& size);
+	bool ReadVector(Vector2& vector);
+
+	std::vector<Uint8> _data; //The whole recording, loaded up front so playback never touches the disk
+	size_t _readOffset = 0;
+	int _remainingRepeats = 0; //Ticks left before the next record needs to be decoded
+
+	InputState _currentState; //The input of the tick being played
+	Uint32 _seed = 0;
+	bool _loaded = false;
+	bool _finished = false;
+	bool _viewerQuit = false; //Escape was pressed while watching
+};
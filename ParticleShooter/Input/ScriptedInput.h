@@ -0,0 +1,30 @@
+//
+//  ScriptedInput.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include "InputState.h"
+
+/*
+	An autopilot for benchmark runs. Produces the InputState for any simulation tick purely from the tick number, so
+	every run plays the level the same way without anyone at the keyboard.
+
+	The player strafes around a square, fires continuously at a cursor circling the screen and charges the beam every
+	few seconds, which keeps the projectile, collision and particle paths busy.
+*/
+class ScriptedInput final
+{
+public:
+	InputState GetInputState(const int tick) const;
+
+private:
+	static const int TICKS_PER_STRAFE = 90; //How long the player moves in one direction before turning
+	static const int TICKS_BETWEEN_BEAMS = 600;
+	static const int BEAM_TICKS = 45; //How long the beam button is held
+	static const int TICKS_PER_CURSOR_ORBIT = 240;
+};
@@ -18,8 +18,14 @@
 class SystemInputController
 {
 public:
+	virtual ~SystemInputController() {} //Controllers are owned and destroyed through this base by the InputManager
+
 	virtual void UpdateEventStatus(bool& eventMarker, const InputEvent& inputEvent, const SDL_Event& polledSDLEvent) = 0;
 	virtual void UpdateCursorPosition(Vector2& vectorMarker) = 0;
 	virtual void UpdateMovementDirection(Vector2& vectorMarker) = 0;
 
+	//Optional hooks for controllers that don't react to SDL events, such as replays. Called once per poll
+	virtual void BeginFrame() {}
+	virtual void UpdateFrameStatus(bool& eventMarker, const InputEvent& inputEvent) {}
+
 };
\ No newline at end of file
@@ -16,6 +16,8 @@ InputManager::InputManager()
 */
 InputState InputManager::PollPlayerInput()
 {
+    _inputController->BeginFrame();
+
     while (SDL_PollEvent(&_polledSDLEvent))
     {
         bool directionEvent; //Not required for Direction events
@@ -27,10 +29,27 @@ InputState InputManager::PollPlayerInput()
         _inputController->UpdateEventStatus(_inputState._RestartPressed, InputEvent::RESTART, _polledSDLEvent);
         _inputController->UpdateEventStatus(_inputState._ShootPressed, InputEvent::SHOOT, _polledSDLEvent);
         _inputController->UpdateEventStatus(_inputState._BeamPressed, InputEvent::BEAM, _polledSDLEvent);
+        _inputController->UpdateEventStatus(_inputState._ProfileTracePressed, InputEvent::PROFILE_TRACE, _polledSDLEvent);
+        _inputController->UpdateEventStatus(_inputState._ProfileOverlayPressed, InputEvent::PROFILE_OVERLAY, _polledSDLEvent);
     }
 
+    _inputController->UpdateFrameStatus(_inputState._ActionPressed, InputEvent::ACTION);
+    _inputController->UpdateFrameStatus(_inputState._BackPressed, InputEvent::BACK);
+    _inputController->UpdateFrameStatus(_inputState._StartPressed, InputEvent::START);
+    _inputController->UpdateFrameStatus(_inputState._QuitPressed, InputEvent::QUIT);
+    _inputController->UpdateFrameStatus(_inputState._RestartPressed, InputEvent::RESTART);
+    _inputController->UpdateFrameStatus(_inputState._ShootPressed, InputEvent::SHOOT);
+    _inputController->UpdateFrameStatus(_inputState._BeamPressed, InputEvent::BEAM);
+    _inputController->UpdateFrameStatus(_inputState._ProfileTracePressed, InputEvent::PROFILE_TRACE);
+    _inputController->UpdateFrameStatus(_inputState._ProfileOverlayPressed, InputEvent::PROFILE_OVERLAY);
+
     _inputController->UpdateCursorPosition(_inputState._CursorPosition); //Rename to _Cursor
     _inputController->UpdateMovementDirection(_inputState._MovementDirection);
 
     return _inputState;
+}
+
+void InputManager::SetInputController(std::unique_ptr<SystemInputController> inputController)
+{
+    _inputController = std::move(inputController);
 }
\ No newline at end of file
@@ -0,0 +1,154 @@
+#include "InputRecorder.h"
+
+#include <cstring>
+
+const char* const InputRecorder::MAGIC = "PSIR";
+
+InputRecorder::~InputRecorder()
+{
+	Close();
+}
+
+/*
+	Description:
+		Starts a new recording and writes its header. Any recording already open is closed first.
+
+	Arguments:
+		filePath - Where to write the recording. Overwritten if it already exists
+		seed - The world seed the GameManager was created with. Replays need it to reproduce the session
+
+	Return:
+		bool - Whether or not the file could be opened
+*/
+bool InputRecorder::Open(const std::string& filePath, const Uint32 seed)
+{
+	Close();
+
+	_file.open(filePath, std::ios::binary | std::ios::trunc);
+	if (!_file.is_open())
+		return false;
+
+	_previousState = InputState();
+	_pendingRepeats = 0;
+	_tickCount = 0;
+
+	_file.write(MAGIC, 4);
+	_file.put(static_cast<char>(FORMAT_VERSION));
+	WriteUint32(seed);
+
+	return true;
+}
+
+/*
+	Description:
+		Appends one simulation tick. Should be given exactly the InputState that was passed to GameManager::Update.
+
+	Arguments:
+		inputState - The tick's input
+*/
+void InputRecorder::Record(const InputState& inputState)
+{
+	if (!_file.is_open())
+		return;
+
+	_tickCount++;
+
+	Uint8 changes = 0;
+	if (PackButtons(inputState) != PackButtons(_previousState))
+		changes |= Change::BUTTONS;
+	if (!(inputState._CursorPosition == _previousState._CursorPosition))
+		changes |= Change::CURSOR;
+	if (!(inputState._MovementDirection == _previousState._MovementDirection))
+		changes |= Change::MOVEMENT;
+
+	if (changes == 0)
+	{
+		_pendingRepeats++;
+		if (_pendingRepeats == MAX_REPEAT)
+			WriteRepeats();
+		return;
+	}
+
+	WriteRepeats();
+	_file.put(static_cast<char>(changes));
+	if (changes & Change::BUTTONS)
+		WriteUint16(PackButtons(inputState));
+	if (changes & Change::CURSOR)
+		WriteVector(inputState._CursorPosition);
+	if (changes & Change::MOVEMENT)
+		WriteVector(inputState._MovementDirection);
+
+	_previousState = inputState;
+}
+
+//Writes out the held ticks that haven't been written yet and closes the file
+void InputRecorder::Close()
+{
+	if (!_file.is_open())
+		return;
+
+	WriteRepeats();
+	_file.close();
+}
+
+//Bit i holds the button whose InputEvent has the value i
+Uint16 InputRecorder::PackButtons(const InputState& inputState)
+{
+	Uint16 buttons = 0;
+	buttons |= inputState._ActionPressed << InputEvent::ACTION;
+	buttons |= inputState._BackPressed << InputEvent::BACK;
+	buttons |= inputState._StartPressed << InputEvent::START;
+	buttons |= inputState._QuitPressed << InputEvent::QUIT;
+	buttons |= inputState._ShootPressed << InputEvent::SHOOT;
+	buttons |= inputState._RestartPressed << InputEvent::RESTART;
+	buttons |= inputState._BeamPressed << InputEvent::BEAM;
+	buttons |= inputState._ProfileTracePressed << InputEvent::PROFILE_TRACE;
+	buttons |= inputState._ProfileOverlayPressed << InputEvent::PROFILE_OVERLAY;
+
+	return buttons;
+}
+
+void InputRecorder::UnpackButtons(const Uint16 buttons, InputState& inputState)
+{
+	inputState._ActionPressed = (buttons >> InputEvent::ACTION) & 1;
+	inputState._BackPressed = (buttons >> InputEvent::BACK) & 1;
+	inputState._StartPressed = (buttons >> InputEvent::START) & 1;
+	inputState._QuitPressed = (buttons >> InputEvent::QUIT) & 1;
+	inputState._ShootPressed = (buttons >> InputEvent::SHOOT) & 1;
+	inputState._RestartPressed = (buttons >> InputEvent::RESTART) & 1;
+	inputState._BeamPressed = (buttons >> InputEvent::BEAM) & 1;
+	inputState._ProfileTracePressed = (buttons >> InputEvent::PROFILE_TRACE) & 1;
+	inputState._ProfileOverlayPressed = (buttons >> InputEvent::PROFILE_OVERLAY) & 1;
+}
+
+void InputRecorder::WriteRepeats()
+{
+	if (_pendingRepeats == 0)
+		return;
+
+	_file.put(static_cast<char>(REPEAT_FLAG | _pendingRepeats));
+	_pendingRepeats = 0;
+}
+
+void InputRecorder::WriteUint16(const Uint16 value)
+{
+	_file.put(static_cast<char>(value & 0xFF));
+	_file.put(static_cast<char>(value >> 8));
+}
+
+void InputRecorder::WriteUint32(const Uint32 value)
+{
+	for (int byte = 0; byte < 4; byte++)
+		_file.put(static_cast<char>((value >> (byte * 8)) & 0xFF));
+}
+
+void InputRecorder::WriteVector(const Vector2& vector)
+{
+	const float components[] = { vector.x, vector.y };
+	for (const float component : components)
+	{
+		Uint32 bits = 0;
+		std::memcpy(&bits, &component, sizeof(bits));
+		WriteUint32(bits);
+	}
+}
@@ -18,6 +18,7 @@ Item::Item(const Rectangle& bounds, const GraphicAssetInfo& media, const Collide
 	_transform->_Collider = collider;
 	_itemResponseEvent = event;
 	_destructionController->SetDestructionTime(_destructionTime);
+	_sceneComponents = SceneComponents::ANIMATION | SceneComponents::LIFETIME; //Items never move
 }
 
 /*
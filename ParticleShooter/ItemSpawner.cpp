@@ -1,8 +1,10 @@
 #include "ColliderResources.h"
+#include "ErrorHandler.h"
 #include "GameObjectRegistryLocator.h"
 #include "GameObjectRegistryService.h"
 #include "GraphicAssetResources.h"
 #include "ItemSpawner.h"
+#include "Random.h"
 #include "Rectangle.h"
 
 #include <memory>
@@ -18,6 +20,9 @@ ItemSpawner::ItemSpawner()
 
 	_itemList.emplace_back(bouncePrototype, _itemBounceSpawnRate);
 	_itemList.emplace_back(healthPrototype, _itemHealthSpawnRate);
+
+	_itemMappings.insert({ ObjectId::PICK_UP_BOUNCE, &bouncePrototype });
+	_itemMappings.insert({ ObjectId::PICK_UP_HEALTH, &healthPrototype });
 }
 
 ItemSpawner& ItemSpawner::GetInstance()
@@ -40,7 +45,7 @@ ItemSpawner& ItemSpawner::GetInstance()
 */
 void ItemSpawner::SpawnItem(const Vector2& position)
 {
-	const int randomNumber = rand() % 100;
+	const int randomNumber = Random::GetWorldInstance().Range(100);
 
 	std::shared_ptr<GameObject> item = nullptr;
 
@@ -62,4 +67,23 @@ void ItemSpawner::SpawnItem(const Vector2& position)
 		GameObjectRegistryService* registry = GameObjectRegistryLocator::GetCreatorService();
 		registry->AddGameObjectToScene(item);
 	}
+}
+
+/*
+	Description:
+		Always spawns the requested Item, unlike the random drop above.
+
+	Arguments:
+		itemId - PICK_UP_BOUNCE or PICK_UP_HEALTH
+		position - The location in world coordinates where the Item spawns
+*/
+void ItemSpawner::SpawnItem(const ObjectId& itemId, const Vector2& position)
+{
+	const auto found = _itemMappings.find(itemId);
+	ErrorHandler::Assert(found != _itemMappings.end(), "Tried to spawn an item that has not been constructed");
+	if (found == _itemMappings.end())
+		return;
+
+	GameObjectRegistryService* registry = GameObjectRegistryLocator::GetCreatorService();
+	registry->AddGameObjectToScene((*found).second->Clone(position));
 }
\ No newline at end of file
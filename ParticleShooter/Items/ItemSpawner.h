@@ -7,8 +7,10 @@
 //
 
 #pragma once
+#include "Common.h"
 #include "Item.h"
 
+#include <unordered_map>
 #include <vector>
 #include <utility>
 
@@ -19,6 +21,7 @@ class ItemSpawner
 {
 public:
 	void SpawnItem(const Vector2& position);
+	void SpawnItem(const ObjectId& itemId, const Vector2& position);
 
 	static ItemSpawner& GetInstance();
 
@@ -31,4 +34,5 @@ private:
 	const int _itemHealthSpawnRate = 7; //Percent change that a Health Item will spawn
 
 	std::vector<std::pair<const Item, const int>> _itemList;
+	std::unordered_map<ObjectId, const Item*> _itemMappings; //Prototypes by Id, for spawning a specific Item
 };
\ No newline at end of file
@@ -0,0 +1,80 @@
+#include "LaunchOptions.h"
+#include "StringResources.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+
+/*
+	Description:
+		Reads the launch flags passed to the game. Unknown flags are ignored.
+
+	Arguments:
+		argc - Number of arguments, including the executable name
+		args - The arguments as passed to main
+
+	Return:
+		LaunchOptions - The parsed settings. Defaults to a normal windowed game
+*/
+LaunchOptions LaunchOptions::Parse(int argc, char* args[])
+{
+	LaunchOptions options;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string flag = args[i];
+
+		if (flag == Resources::Strings::BUNDLE_ASSETS_FLAG)
+			options._BundleAssets = true;
+		else if (flag == Resources::Strings::SOFTWARE_RENDERER_FLAG)
+			options._RenderingBackend = RenderingBackend::SOFTWARE;
+		else if (flag == Resources::Strings::HEADLESS_FLAG)
+			options._RenderingBackend = RenderingBackend::NONE;
+		else if (flag == Resources::Strings::UNCAPPED_FLAG)
+			options._Uncapped = true;
+		else if (flag == Resources::Strings::TICK_LIMIT_FLAG && i + 1 < argc)
+			options._TickLimit = std::max(std::atoi(args[++i]), 0);
+		else if (flag == Resources::Strings::PROFILE_FLAG)
+			options._Profile = true;
+		else if (flag == Resources::Strings::PROFILE_OVERLAY_FLAG)
+			options._ProfileOverlay = true;
+		else if (flag == Resources::Strings::BENCHMARK_FLAG && i + 1 < argc)
+		{
+			options._BenchmarkReport = args[++i];
+			options._RenderingBackend = RenderingBackend::NONE;
+			options._Uncapped = true;
+			options._Deterministic = true;
+		}
+		else if (flag == Resources::Strings::DETERMINISTIC_FLAG)
+			options._Deterministic = true;
+		else if (flag == Resources::Strings::SEED_FLAG && i + 1 < argc)
+		{
+			options._Seed = static_cast<Uint32>(std::strtoul(args[++i], nullptr, 10));
+			options._Deterministic = true;
+		}
+		else if (flag == Resources::Strings::RECORD_FLAG && i + 1 < argc)
+		{
+			options._RecordPath = args[++i];
+			options._Deterministic = true;
+		}
+		else if (flag == Resources::Strings::REPLAY_FLAG && i + 1 < argc)
+		{
+			options._ReplayPath = args[++i];
+			options._Deterministic = true;
+		}
+		else if (flag == Resources::Strings::STRESS_FLAG && i + 1 < argc)
+			options._StressEnemies = std::max(std::atoi(args[++i]), 0);
+		else if (flag == Resources::Strings::STRESS_PICKUPS_FLAG && i + 1 < argc)
+			options._StressPickups = std::max(std::atoi(args[++i]), 0);
+		else if (flag == Resources::Strings::STRESS_GRID_FLAG)
+			options._StressGrid = true;
+		else if (flag == Resources::Strings::STATS_FLAG && i + 1 < argc)
+			options._StatsPath = args[++i];
+		else if (flag == Resources::Strings::ALLOCATION_REPORT_FLAG && i + 1 < argc)
+			options._AllocationReport = args[++i];
+		else if (flag == Resources::Strings::ALLOCATION_THRESHOLD_FLAG && i + 1 < argc)
+			options._AllocationThreshold = std::max(std::atoi(args[++i]), 0);
+	}
+
+	return options;
+}
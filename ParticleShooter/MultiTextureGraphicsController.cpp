@@ -1,3 +1,4 @@
+#include "FrameArena.h"
 #include "MultiTextureGraphicsController.h"
 
 /*
@@ -26,8 +27,13 @@ void MultiTextureGraphicsController::AddTexture(const std::string& filePath, con
 /*
 	Returns:
 		An array of all of the textures in this GC. To be rendered all at the same time each frame.
+		Allocated from the FrameArena.
 */
-std::vector<std::shared_ptr<const Texture>> MultiTextureGraphicsController::GetCurrentTextures() const
+Span<const Texture* const> MultiTextureGraphicsController::GetCurrentTextures() const
 {
-	return _textures;
+	const Span<const Texture*> textures = FrameArena::GetInstance().AllocateArray<const Texture*>(_textures.size());
+	for (size_t i = 0; i < _textures.size(); i++)
+		textures[i] = _textures[i].get();
+
+	return textures;
 }
\ No newline at end of file
@@ -16,6 +16,8 @@ PCInputController::PCInputController()
     _eventKeyMapping.insert({ InputEvent::START, SDLK_KP_ENTER });
     _eventKeyMapping.insert({ InputEvent::QUIT, SDLK_ESCAPE });
     _eventKeyMapping.insert({ InputEvent::RESTART, SDLK_r });
+    _eventKeyMapping.insert({ InputEvent::PROFILE_TRACE, SDLK_F9 });
+    _eventKeyMapping.insert({ InputEvent::PROFILE_OVERLAY, SDLK_F10 });
 
     _eventMouseMapping.insert({ InputEvent::SHOOT, SDL_BUTTON_LEFT });
     _eventMouseMapping.insert({ InputEvent::BEAM, SDL_BUTTON_RIGHT });
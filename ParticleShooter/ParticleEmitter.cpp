@@ -0,0 +1,97 @@
+#include "Animation.h"
+#include "Animator.h"
+#include "ErrorHandler.h"
+#include "ParticleEmitter.h"
+#include "Timer.h"
+
+#include <algorithm>
+
+ParticleEmitter::ParticleEmitter(const std::shared_ptr<const Animation>& animation, const RenderingLayer& layer, const float& lifetime, const int& capacity)
+	: _animation(animation), _renderingLayer(layer), _capacity(capacity)
+{
+	ErrorHandler::Assert(animation != nullptr && animation->GetFrameCount() > 0, "Particle emitters need an animation with at least one frame");
+	ErrorHandler::Assert(capacity > 0, "Particle emitters need room for at least one particle");
+
+	for (int i = 0; i < _animation->GetFrameCount(); i++)
+		_frameTextures.push_back(_animation->GetCurrentFrame(i).get());
+
+	//A non looping animation shows nothing after its last frame, so there is no reason to keep the particle around any longer
+	_frameDuration = static_cast<Uint32>(Animator::TIME_PER_FRAME / _animation->GetAnimationSpeed());
+	const Uint32 animationDuration = _frameDuration * static_cast<Uint32>(_frameTextures.size());
+	_lifetime = lifetime > 0 ? std::min(static_cast<Uint32>(lifetime * 1000), animationDuration) : animationDuration;
+
+	_positions.resize(_capacity);
+	_angles.resize(_capacity);
+	_frames.resize(_capacity);
+	_frameStartTimes.resize(_capacity);
+	_spawnTimes.resize(_capacity);
+}
+
+/*
+	Description:
+		Starts a new particle at the first frame of the animation. When the pool is full, the oldest particle is recycled.
+
+	Arguments:
+		position - Where the particle is drawn in world coordinates
+		direction - Where the particle is facing. Up (0, -1) draws the texture unrotated
+*/
+void ParticleEmitter::Spawn(const Vector2& position, const Vector2& direction)
+{
+	if (_count == _capacity)
+	{
+		_head = (_head + 1) % _capacity;
+		_count--;
+	}
+
+	const int index = GetIndex(_count);
+	_count++;
+
+	//Matches the orientation Transform::SetForwardVector derives from a direction
+	double angle = 0.0;
+	if (!(direction == Vector2(0, 0)))
+	{
+		angle = Vector2(0, -1).AngleBetween(direction.Normal());
+		if (Vector2(1, 0).DotProduct(direction) < 0)
+			angle *= -1;
+	}
+
+	const Uint32 now = Timer::GetCurrentMilliseconds(Timer::GetDefaultTimeSource());
+	_positions[index] = position;
+	_angles[index] = angle;
+	_frames[index] = 0;
+	_frameStartTimes[index] = now;
+	_spawnTimes[index] = now;
+}
+
+/*
+	Description:
+		Retires expired particles from the front of the ring and advances every other particle's frame.
+		Like Animator, a particle moves forward at most a single frame per update.
+*/
+void ParticleEmitter::Update()
+{
+	const Uint32 now = Timer::GetCurrentMilliseconds(Timer::GetDefaultTimeSource());
+
+	while (_count > 0 && now - _spawnTimes[_head] >= _lifetime)
+	{
+		_head = (_head + 1) % _capacity;
+		_count--;
+	}
+
+	const int lastFrame = static_cast<int>(_frameTextures.size()) - 1;
+	for (int i = 0; i < _count; i++)
+	{
+		const int index = GetIndex(i);
+		if (now - _frameStartTimes[index] >= _frameDuration && _frames[index] < lastFrame)
+		{
+			_frames[index]++;
+			_frameStartTimes[index] = now;
+		}
+	}
+}
+
+void ParticleEmitter::Clear()
+{
+	_head = 0;
+	_count = 0;
+}
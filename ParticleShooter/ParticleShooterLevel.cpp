@@ -20,6 +20,7 @@ void ParticleShooterLevel::Restart()
 	_levelComplete = false;
 	_delayLevel = true;
 	_startDelayTimer.Start();
+	_enemyManager.ClearReservations();
 	for (auto& wave : _waves)
 	{
 		wave.second.Restart();
@@ -61,7 +62,7 @@ void ParticleShooterLevel::Update(GameObjectObserver& observer)
 		Handles Wave management. Transitions to the next wave if the current one is complete.
 		Starts Waves if they have not been started.
  */
-void ParticleShooterLevel::UpdateCurrentWave(GameObjectObserver& observer, const EnemyManager& enemyManager)
+void ParticleShooterLevel::UpdateCurrentWave(GameObjectObserver& observer, EnemyManager& enemyManager)
 {
 	Wave& wave = _waves[_currentWave];
 
@@ -81,7 +82,7 @@ void ParticleShooterLevel::UpdateCurrentWave(GameObjectObserver& observer, const
 void ParticleShooterLevel::StartCurrentWave(GameObjectObserver& observer)
 {
 	Wave& wave = _waves[_currentWave];
-	wave.StartWave();
+	wave.StartWave(_enemyManager);
 	if (_waves.size() - 1 == _currentWave)
 		observer.Notify(GameObjectEvent::FINAL_WAVE_START);
 	else
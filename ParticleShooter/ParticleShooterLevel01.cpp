@@ -1,5 +1,7 @@
+#include "BackgroundCompositor.h"
 #include "ColliderResources.h"
 #include "ErrorHandler.h"
+#include "FrameArena.h"
 #include "ParticleShooterLevel01.h"
 #include "Transform.h"
 
@@ -94,31 +96,36 @@ void ParticleShooterLevel01::LoadWaves()
 /*
 	Description:
 		Adds a variety of background PNGs representing the Level background to the graphics controller.
+		Layers sharing a parallax factor are pre-composited into tiles so only the visible tiles are drawn each frame.
  */
 void ParticleShooterLevel01::LoadBackgroundImages()
 {
 	_graphicsController.reset(new MultiTextureGraphicsController());
 	_graphicsController->SetRenderingLayer(RenderingLayer::LEVEL);
 
-	_graphicsController->AddTexture("Assets/World/Layer_04.png", 0, 0);
-	_graphicsController->AddTexture("Assets/World/Layer_04.png", 1500, 0);
-	_graphicsController->AddTexture("Assets/World/Layer_04.png", 0, 1000);
-	_graphicsController->AddTexture("Assets/World/Layer_04.png", 1500, 1000);
-
-	_graphicsController->AddTexture("Assets/World/Layer_03_01.png", 0 - 150, 0 - 175, 0.7);
-	_graphicsController->AddTexture("Assets/World/Layer_03_02.png", 1500 - 150, 0 - 175, 0.7);
-	_graphicsController->AddTexture("Assets/World/Layer_03_03.png", 0 - 150, 1000 - 175, 0.7);
-	_graphicsController->AddTexture("Assets/World/Layer_03_04.png", 1500 - 150, 1000 - 175, 0.7);
-
-	_graphicsController->AddTexture("Assets/World/Layer_02_01.png", 0 - 50, -100, 0.85);
-	_graphicsController->AddTexture("Assets/World/Layer_02_02.png", 1500 - 50, -100, 0.85);
-	_graphicsController->AddTexture("Assets/World/Layer_02_03.png", 0 - 50, 1000 - 100, 0.85);
-	_graphicsController->AddTexture("Assets/World/Layer_02_04.png", 1500 - 50, 1000 - 100, 0.85);
-
-	_graphicsController->AddTexture("Assets/World/Layer_01_01.png", 0, 0);
-	_graphicsController->AddTexture("Assets/World/Layer_01_02.png", 1500, 0);
-	_graphicsController->AddTexture("Assets/World/Layer_01_03.png", 0, 1000);
-	_graphicsController->AddTexture("Assets/World/Layer_01_04.png", 1500, 1000);
+	BackgroundCompositor background;
+
+	background.AddLayer("Assets/World/Layer_04.png", 0, 0);
+	background.AddLayer("Assets/World/Layer_04.png", 1500, 0);
+	background.AddLayer("Assets/World/Layer_04.png", 0, 1000);
+	background.AddLayer("Assets/World/Layer_04.png", 1500, 1000);
+
+	background.AddLayer("Assets/World/Layer_03_01.png", 0 - 150, 0 - 175, 0.7);
+	background.AddLayer("Assets/World/Layer_03_02.png", 1500 - 150, 0 - 175, 0.7);
+	background.AddLayer("Assets/World/Layer_03_03.png", 0 - 150, 1000 - 175, 0.7);
+	background.AddLayer("Assets/World/Layer_03_04.png", 1500 - 150, 1000 - 175, 0.7);
+
+	background.AddLayer("Assets/World/Layer_02_01.png", 0 - 50, -100, 0.85);
+	background.AddLayer("Assets/World/Layer_02_02.png", 1500 - 50, -100, 0.85);
+	background.AddLayer("Assets/World/Layer_02_03.png", 0 - 50, 1000 - 100, 0.85);
+	background.AddLayer("Assets/World/Layer_02_04.png", 1500 - 50, 1000 - 100, 0.85);
+
+	background.AddLayer("Assets/World/Layer_01_01.png", 0, 0);
+	background.AddLayer("Assets/World/Layer_01_02.png", 1500, 0);
+	background.AddLayer("Assets/World/Layer_01_03.png", 0, 1000);
+	background.AddLayer("Assets/World/Layer_01_04.png", 1500, 1000);
+
+	background.Composite(*_graphicsController);
 }
 
 /*
@@ -177,16 +184,13 @@ void ParticleShooterLevel01::LoadColliders()
 
 /*
 	Description:
-		Returns interfaces to all of the environmental colliders associated with this level
+		Returns interfaces to all of the environmental colliders associated with this level, allocated from the FrameArena
  */
-std::vector<ColliderInterface*> ParticleShooterLevel01::GetLevelColliders()
+Span<ColliderInterface* const> ParticleShooterLevel01::GetLevelColliders()
 {
-	std::vector<ColliderInterface*> _colliderInterfaces;
-
-	for (Collider& collider : _colliders)
-	{
-		_colliderInterfaces.push_back(&collider);
-	}
+	const Span<ColliderInterface*> colliderInterfaces = FrameArena::GetInstance().AllocateArray<ColliderInterface*>(_colliders.size());
+	for (size_t i = 0; i < _colliders.size(); i++)
+		colliderInterfaces[i] = &_colliders[i];
 
-	return _colliderInterfaces;
+	return colliderInterfaces;
 }
@@ -0,0 +1,11 @@
+#include "ParticleShooterStressLevel.h"
+
+ParticleShooterStressLevel::ParticleShooterStressLevel(const StressScenario& scenario) : _scenario(scenario)
+{
+}
+
+void ParticleShooterStressLevel::LoadWaves()
+{
+	const Rectangle spawnArea(_bounds._Origin.x + SPAWN_MARGIN, _bounds._Origin.y + SPAWN_MARGIN, _bounds._Width - 2 * SPAWN_MARGIN, _bounds._Height - 2 * SPAWN_MARGIN);
+	_scenario.Populate(*this, spawnArea);
+}
@@ -0,0 +1,80 @@
+#include "ParticleSystem.h"
+#include "Renderer.h"
+#include "Stats.h"
+
+#include <algorithm>
+
+ParticleSystem::~ParticleSystem()
+{
+	for (const std::shared_ptr<ParticleEmitter>& emitter : _emitters)
+		emitter->SetIsRegistered(false);
+}
+
+/*
+	Description:
+		Spawns a single particle, registering the emitter the first time it is used.
+
+	Arguments:
+		emitter - The pool the particle belongs to
+		position - Where the particle is drawn in world coordinates
+		direction - Where the particle is facing
+*/
+void ParticleSystem::Spawn(const std::shared_ptr<ParticleEmitter>& emitter, const Vector2& position, const Vector2& direction)
+{
+	_spawnCredit = std::min(_spawnCredit + _spawnRate, 1.0f);
+	if (_spawnCredit < 1.0f)
+		return;
+	_spawnCredit -= 1.0f;
+
+	if (!emitter->IsRegistered())
+	{
+		emitter->SetIsRegistered(true);
+		_emitters.push_back(emitter);
+	}
+
+	emitter->Spawn(position, direction);
+	Stats::GetInstance().Increment(StatCounter::PARTICLES_SPAWNED);
+}
+
+/*
+	Description:
+		Ages every registered emitter's particles. Emitters whose prototype has been destroyed are dropped
+		once their last particle expires.
+*/
+void ParticleSystem::Update()
+{
+	for (auto it = _emitters.begin(); it != _emitters.end();)
+	{
+		(*it)->Update();
+
+		const bool orphaned = it->use_count() == 1 && (*it)->GetCount() == 0;
+		if (orphaned)
+			it = _emitters.erase(it);
+		else
+			it++;
+	}
+}
+
+/*
+	Description:
+		Renders the live particles of every emitter on the given layer. Called once per layer so that
+		particles keep their place in the layer ordering alongside the GameObjects.
+
+	Arguments:
+		renderer - Where the particles are drawn
+		renderingLayer - Only emitters on this layer are drawn
+*/
+void ParticleSystem::Render(Renderer& renderer, const RenderingLayer& renderingLayer) const
+{
+	for (const std::shared_ptr<ParticleEmitter>& emitter : _emitters)
+	{
+		if (emitter->GetRenderingLayer() == renderingLayer && emitter->GetCount() > 0)
+			renderer.Render(*emitter);
+	}
+}
+
+void ParticleSystem::Clear()
+{
+	for (const std::shared_ptr<ParticleEmitter>& emitter : _emitters)
+		emitter->Clear();
+}
@@ -79,7 +79,7 @@ private:
     bool _active = true; //Turns on or off the collider during collision detection
 
     ColliderType _type = ColliderType::ENVIRONMENT;
-    bool _ignoreTypes[ColliderType::ALL]; //Collider Types that will be ignored during collision detection
+    unsigned int _ignoreTypes = 0; //Bit per ColliderType that will be ignored during collision detection
 
     CollisionResponseInfo _responseInfo; //The most recent collision detection response information. Updated each frame.
 };
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "Span.h"
+
 #include <vector>
 
 class ColliderInterface;
@@ -24,8 +26,9 @@ public:
 	void SimulateCurrentCollisions() const; //Runs through collision detection by comparing all of the colliders in _colliders
 
 	void AddCollider(ColliderInterface* collider);
-	void AddCollider(const std::vector<ColliderInterface*>& colliders);
+	void AddCollider(const Span<ColliderInterface* const>& colliders);
 	void RemoveCollider(ColliderInterface* collider);
+	void RemoveColliders(const Span<ColliderInterface* const>& colliders);
 
 	void RemoveAllColliders() { _colliders.clear(); }
 
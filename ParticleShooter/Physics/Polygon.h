@@ -13,11 +13,17 @@
 #include <vector>
 #include <memory>
 
-//Polygon class represented by a list of points corresponding to each vertex
+/*
+    Polygon class represented by a list of points corresponding to each vertex.
+
+    Copies share their vertices and perpendiculars with the source until either is edited, so the colliders of
+    every clone made from a prototype point at the prototype's shape instead of holding their own copy of it.
+*/
 class Polygon
 {
 public:
     Polygon();
+    Polygon(const Polygon& source);
 
     const Vector2& GetCenter() const { return _center; }
 
@@ -35,12 +41,13 @@ public:
 
 private:
     Vector2 _center;
-    std::shared_ptr<std::vector<Vector2>> _vertices = nullptr;
-    mutable std::shared_ptr<std::vector<Vector2>> _perpendiculars = nullptr;
+    std::shared_ptr<std::vector<Vector2>> _vertices = nullptr; //May be shared with copies. Only edited after DetachVertices
+    mutable std::shared_ptr<std::vector<Vector2>> _perpendiculars = nullptr; //May be shared with copies. Replaced rather than edited while shared
     int _numOfVertices = 0;
 
     mutable bool _dirtyPerpendiculars = true; //Dirty flag which signifies that the perpendiculars should be recalculated. Typically set when the poylgon is rotated or a vertex is added.
 
+    void DetachVertices(); //Gives this Polygon its own copy of the vertices if they are shared
     void RecalculateCenterPoint();
     void RecalculatePerpendicularVectors() const; //Recalculates the perpendicular normals for each polygon edge given the current vertices. Resets dirty flag.
 };
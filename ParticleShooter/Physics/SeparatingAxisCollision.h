@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <memory_resource>
 #include <vector>
 
 class ColliderInterface;
@@ -37,5 +38,5 @@ namespace SeparatingAxisCollision
 	Extents CalculateMinMixProjection(const Vector2& projectionVector, const ColliderInterface* polygon);
 	Extents CalculateMinMixProjection(const Vector2& projectionVector, const Vector2& point);
 	bool IsSeparatingAxis(const Extents& projectionExtentsA, const Extents& projectionExtentsB);
-	void CalculateCollidingVertices(const ColliderInterface* polygonA, const ColliderInterface* polygonB, std::vector<Vector2>& collidingVerticesA);
+	void CalculateCollidingVertices(const ColliderInterface* polygonA, const ColliderInterface* polygonB, std::pmr::vector<Vector2>& collidingVerticesA);
 }
\ No newline at end of file
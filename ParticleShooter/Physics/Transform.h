@@ -42,6 +42,11 @@ public:
 	Rectangle GetBounds() const { return _aabb; }
 	Vector2 GetForwardVector() const { return _forwardVector; }
 	double GetOrientationAngle() const { return _orientation; }
+
+	/* Interpolation */
+	void StorePreviousPose(); //Called once at the start of every simulation tick. The stored pose is what rendering blends from
+	Vector2 GetInterpolatedOrigin(const float& alpha) const;
+	double GetInterpolatedOrientationAngle(const float& alpha) const;
 	
 	std::vector<ColliderBaton> ResolveCollisions();
 
@@ -53,6 +58,11 @@ private:
 	Vector2 _forwardVector;
 	double _orientation = 0.0; //Best not to set directly as it skips over Collider rotation. Use the "SetOrientation" helper function instead
 
+	/* Pose at the start of the current simulation tick. Rendering blends from this pose to the current one */
+	Vector2 _previousOrigin;
+	double _previousOrientation = 0.0;
+	bool _hasPreviousPose = false; //False until the first StorePreviousPose. Freshly spawned clones render exactly where they were placed
+
 	void SetOrientation(const double& rotationValue);
 	void SetPosition(const Vector2& position);
 };
\ No newline at end of file
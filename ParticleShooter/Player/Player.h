@@ -28,6 +28,7 @@ public:
 
 	PlayerInfo Update(const InputState& inputState);
 	void PauseUpdates() { _updatesPaused = true; };
+	void StorePreviousPose() { _transform->StorePreviousPose(); } //Marks the start of a simulation tick for render interpolation
 
 	/* Getters */
 	ColliderInterface* GetCollider() { return &_transform->_Collider; }
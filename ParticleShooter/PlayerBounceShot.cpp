@@ -22,6 +22,7 @@ PlayerBounceShot::PlayerBounceShot() : Projectile()
 	_propertyController.SetPropertyValue(Property::BOUNCE_COUNT, _totalBounces);
 
 	_fireEvent = GameObjectEvent::BOUNCE_ATTACK;
+	_sceneComponents &= ~SceneComponents::MOTION; //Only moves once it has counted its bounces in Update
 }
 
 std::shared_ptr<Projectile> PlayerBounceShot::Clone(const Vector2& position) const
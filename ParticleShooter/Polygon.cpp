@@ -2,22 +2,45 @@
 #include "Polygon.h"
 #include "Vector2.h"
 
-Polygon::Polygon()
+#include <climits>
+#include <cmath>
+
+namespace
+{
+	//Shared by every Polygon without vertices, so default constructed Polygons don't allocate
+	const std::shared_ptr<std::vector<Vector2>>& EmptyVertices()
+	{
+		static const std::shared_ptr<std::vector<Vector2>> EMPTY = std::make_shared<std::vector<Vector2>>();
+		return EMPTY;
+	}
+}
+
+Polygon::Polygon() : _vertices(EmptyVertices()), _perpendiculars(EmptyVertices())
 {
-	_vertices.reset(new std::vector<Vector2>());
-	_perpendiculars.reset(new std::vector<Vector2>());
 }
 
+Polygon::Polygon(const Polygon& source)
+{
+	*this = source;
+}
+
+/*
+	Description:
+		Shares the source's vertices and perpendiculars instead of copying them. The source's perpendiculars are
+		brought up to date first so that every copy of a prototype reuses the same ones.
+*/
 void Polygon::operator=(const Polygon& source)
 {
 	if (this == &source)
 		return;
 
-	_vertices->clear();
-	_perpendiculars->clear();
+	source.GetPerpendiculars();
 
-	_vertices->insert(_vertices->end(), source._vertices->cbegin(), source._vertices->cend());
-	_perpendiculars->insert(_perpendiculars->end(), source._perpendiculars->cbegin(), source._perpendiculars->cend());
+	_center = source._center;
+	_numOfVertices = source._numOfVertices;
+	_vertices = source._vertices;
+	_perpendiculars = source._perpendiculars;
+	_dirtyPerpendiculars = source._dirtyPerpendiculars;
 }
 
 void Polygon::AddVertexPoint(float x, float y)
@@ -27,6 +50,7 @@ void Polygon::AddVertexPoint(float x, float y)
 
 void Polygon::AddVertexPoint(const Vector2& vertex)
 {
+	DetachVertices();
 	_vertices->push_back(vertex);
 	_numOfVertices++;
 	_dirtyPerpendiculars = true; //New vertex means a new edge has been added. Perpendiculars need to be recalculated
@@ -68,6 +92,10 @@ const std::shared_ptr<const std::vector<Vector2>> Polygon::GetPerpendiculars() c
 */
 void Polygon::Rotate(float degrees)
 {
+	if (degrees == 0)
+		return;
+
+	DetachVertices();
 	const float radians = CommonHelpers::DegToRad(degrees);
 
 	for (int i = 0; i < _vertices->size(); i++)
@@ -79,8 +107,13 @@ void Polygon::Rotate(float degrees)
 		_vertices->at(i).y = newY;
 	}
 
-	if (degrees != 0)
-		_dirtyPerpendiculars = true;
+	_dirtyPerpendiculars = true;
+}
+
+void Polygon::DetachVertices()
+{
+	if (_vertices.use_count() > 1)
+		_vertices = std::make_shared<std::vector<Vector2>>(*_vertices);
 }
 
 /*
@@ -92,19 +125,26 @@ void Polygon::Rotate(float degrees)
 */
 void Polygon::RecalculatePerpendicularVectors() const
 {
-	_perpendiculars->clear();
+	_dirtyPerpendiculars = false;
 
-	if (_vertices->size() >= 2)
+	if (_vertices->size() < 2)
 	{
-		for (int i = 0; i < _vertices->size() - 1; i++)
-		{
-			_perpendiculars->push_back(ClockwisePerpendicularVector(_vertices->at(i), _vertices->at(i + 1)));
-		}
-		//Wrap the last vertex to the first for the final polygon perpendicular
-		_perpendiculars->push_back(ClockwisePerpendicularVector(_vertices->at(_vertices->size() - 1), _vertices->at(0)));
+		_perpendiculars = EmptyVertices();
+		return;
 	}
 
-	_dirtyPerpendiculars = false;
+	//Copies sharing the old perpendiculars keep them. They still match their own vertices
+	if (_perpendiculars.use_count() > 1)
+		_perpendiculars = std::make_shared<std::vector<Vector2>>();
+	else
+		_perpendiculars->clear();
+
+	for (int i = 0; i < _vertices->size() - 1; i++)
+	{
+		_perpendiculars->push_back(ClockwisePerpendicularVector(_vertices->at(i), _vertices->at(i + 1)));
+	}
+	//Wrap the last vertex to the first for the final polygon perpendicular
+	_perpendiculars->push_back(ClockwisePerpendicularVector(_vertices->at(_vertices->size() - 1), _vertices->at(0)));
 }
 
 void Polygon::RecalculateCenterPoint()
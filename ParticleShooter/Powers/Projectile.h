@@ -25,6 +25,7 @@ public:
 
 	void Fire(const Vector2& direction); //Applies an impulse velocity in the specified direction
 	virtual std::shared_ptr<Projectile> Clone(const Vector2& position) const;
+	void Rearm(const Projectile& prototype, const Vector2& position); //Resets a spent clone of prototype in place, as if it had just been cloned
 
 	virtual void Update(const PlayerInfo& playerInfo, const Vector2& cameraPosition, const InputState& input) override;
 	inline ColliderInterface* GetCollider() override;
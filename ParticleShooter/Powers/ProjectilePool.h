@@ -0,0 +1,45 @@
+//
+//  ProjectilePool.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include "Projectile.h"
+
+#include <memory>
+#include <vector>
+
+/*
+	Recycles the Projectiles cloned from a single prototype. A pooled Projectile is free again once the scene has let go
+	of it, which happens the tick after it is destroyed. Free Projectiles are re-armed in place from the prototype instead
+	of being cloned, so steady fire stops allocating once the pool has grown to the number of shots in flight.
+
+	Pools never shrink, so a pool's size is also the most of its Projectiles that have been in flight at once.
+	The combined size of every pool and the largest single pool are reported to Stats.
+*/
+class ProjectilePool final
+{
+public:
+	ProjectilePool(std::shared_ptr<const Projectile> prototype);
+	~ProjectilePool();
+
+	std::shared_ptr<Projectile> Acquire(const Vector2& position);
+
+	/* Getters */
+	int GetSize() const { return static_cast<int>(_projectiles.size()); }
+
+private:
+	ProjectilePool(const ProjectilePool&);
+	ProjectilePool& operator=(const ProjectilePool&);
+
+	std::shared_ptr<const Projectile> _prototype = nullptr; //What every pooled Projectile is armed as
+	std::vector<std::shared_ptr<Projectile>> _projectiles; //Free when the pool holds the only reference
+	size_t _nextCandidate = 0; //Where the search for a free Projectile starts. Shots expire roughly in the order they were fired
+
+	static int TOTAL_POOLED; //Projectiles held by every live pool
+	static int LARGEST_POOL; //Size of the largest pool since launch
+};
@@ -9,10 +9,11 @@
 #pragma once
 
 #include "Projectile.h"
+#include "ProjectilePool.h"
 
 #include <memory>
 
-//Spawns and fires Projectiles at a specified rate
+//Spawns and fires Projectiles at a specified rate. Copies of a shooter share the prototype's ProjectilePool
 class ProjectileShooter
 {
 public:
@@ -23,6 +24,7 @@ public:
 
 private:
 	std::shared_ptr<const Projectile> _projectilePrototype = nullptr; //The Projectile instance that will be copied and fired
+	std::shared_ptr<ProjectilePool> _pool = nullptr; //Recycles the fired copies of _projectilePrototype
 
 	double _delay = 0.15; //How often the Shooter is allowed to fire (seconds)
 	Timer _delayTimer;
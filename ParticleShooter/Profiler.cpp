@@ -0,0 +1,184 @@
+#include "Profiler.h"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+
+namespace
+{
+	std::atomic<Uint32> NEXT_THREAD_ID{ 0 };
+	thread_local const Uint32 THREAD_ID = NEXT_THREAD_ID++; //Small stable ids read better in trace viewers than OS thread ids
+}
+
+Profiler::Profiler() : _events(new Event[CAPACITY])
+{
+	_frequency = SDL_GetPerformanceFrequency();
+	_epoch = SDL_GetPerformanceCounter();
+}
+
+Profiler& Profiler::GetInstance()
+{
+	static Profiler profiler;
+	return profiler;
+}
+
+/*
+	Description:
+		Publishes a finished zone into the ring buffer. Safe to call from any thread.
+
+	Arguments:
+		name - String literal naming the zone
+		start - SDL_GetPerformanceCounter when the zone began
+		end - SDL_GetPerformanceCounter when the zone ended
+*/
+void Profiler::RecordZone(const char* name, const Uint64 start, const Uint64 end)
+{
+	const Uint64 index = _nextEvent.fetch_add(1, std::memory_order_relaxed);
+	Event& event = _events[index % CAPACITY];
+
+	event._Sequence.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	event._Name = name;
+	event._Start = start;
+	event._End = end;
+	event._ThreadId = THREAD_ID;
+
+	event._Sequence.store(index + 1, std::memory_order_release);
+}
+
+/*
+	Description:
+		Copies every fully written zone out of the ring buffer, oldest first. Zones that are overwritten
+		while being copied are skipped.
+
+	Return:
+		std::vector<EventCopy> - The recorded zones
+*/
+std::vector<Profiler::EventCopy> Profiler::CopyEvents() const
+{
+	const Uint64 recorded = _nextEvent.load(std::memory_order_acquire);
+	const Uint64 first = recorded > CAPACITY ? recorded - CAPACITY : 0;
+
+	std::vector<EventCopy> events;
+	events.reserve(static_cast<size_t>(recorded - first));
+
+	for (Uint64 index = first; index < recorded; index++)
+	{
+		const Event& event = _events[index % CAPACITY];
+		if (event._Sequence.load(std::memory_order_acquire) != index + 1)
+			continue;
+
+		const EventCopy copy = { event._Name, event._Start, event._End, event._ThreadId };
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (event._Sequence.load(std::memory_order_relaxed) == index + 1)
+			events.push_back(copy);
+	}
+
+	return events;
+}
+
+double Profiler::ToMicroseconds(const Uint64 ticks) const
+{
+	return static_cast<double>(ticks) * 1000000.0 / static_cast<double>(_frequency);
+}
+
+/*
+	Description:
+		Writes the recorded zones as Chrome's trace event JSON. Open the file from about:tracing or ui.perfetto.dev
+
+	Arguments:
+		filePath - Where to write the trace. Overwritten if it already exists
+
+	Return:
+		bool - Whether or not the trace was written
+*/
+bool Profiler::WriteChromeTrace(const std::string& filePath) const
+{
+	std::ofstream trace(filePath, std::ios::trunc);
+	if (!trace)
+		return false;
+
+	std::vector<EventCopy> events = CopyEvents();
+	std::sort(events.begin(), events.end(), [](const EventCopy& a, const EventCopy& b) { return a._Start < b._Start; });
+
+	trace << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+	for (size_t i = 0; i < events.size(); i++)
+	{
+		const EventCopy& event = events.at(i);
+		trace << (i == 0 ? "\n" : ",\n")
+			<< "{\"name\":\"" << event._Name << "\",\"cat\":\"ParticleShooter\",\"ph\":\"X\",\"pid\":1"
+			<< ",\"tid\":" << event._ThreadId
+			<< ",\"ts\":" << ToMicroseconds(event._Start - _epoch)
+			<< ",\"dur\":" << ToMicroseconds(event._End - event._Start) << "}";
+	}
+	trace << "\n]}\n";
+
+	return trace.good();
+}
+
+/*
+	Description:
+		Averages and worst case times for every zone recorded within the last windowSeconds.
+
+	Arguments:
+		windowSeconds - How far back to look from the most recent zone
+
+	Return:
+		std::vector<ZoneSummary> - One entry per zone, sorted by name so the overlay's rows don't move around
+*/
+std::vector<Profiler::ZoneSummary> Profiler::GetZoneSummaries(const double& windowSeconds) const
+{
+	const std::vector<EventCopy> events = CopyEvents();
+
+	Uint64 latest = 0;
+	for (const EventCopy& event : events)
+		latest = std::max(latest, event._End);
+	const Uint64 windowTicks = static_cast<Uint64>(windowSeconds * _frequency);
+	const Uint64 windowStart = latest > windowTicks ? latest - windowTicks : 0;
+
+	return Summarize(events, windowStart);
+}
+
+/*
+	Description:
+		Averages and worst case times for every zone that finished after a given point in time. Lets a caller
+		harvest the buffer in chunks before it wraps.
+
+	Arguments:
+		since - SDL_GetPerformanceCounter value to start from
+
+	Return:
+		std::vector<ZoneSummary> - One entry per zone, sorted by name
+*/
+std::vector<Profiler::ZoneSummary> Profiler::GetZoneSummariesSince(const Uint64 since) const
+{
+	return Summarize(CopyEvents(), since);
+}
+
+std::vector<Profiler::ZoneSummary> Profiler::Summarize(const std::vector<EventCopy>& events, const Uint64 windowStart) const
+{
+	std::map<std::string, ZoneSummary> summaries;
+	for (const EventCopy& event : events)
+	{
+		if (event._End < windowStart)
+			continue;
+
+		ZoneSummary& summary = summaries[event._Name];
+		const double milliseconds = ToMicroseconds(event._End - event._Start) / 1000.0;
+		summary._Name = event._Name;
+		summary._AverageMilliseconds += milliseconds; //Divided by the count below
+		summary._WorstMilliseconds = std::max(summary._WorstMilliseconds, milliseconds);
+		summary._Count++;
+	}
+
+	std::vector<ZoneSummary> results;
+	for (std::pair<const std::string, ZoneSummary>& summary : summaries)
+	{
+		summary.second._AverageMilliseconds /= summary.second._Count;
+		results.push_back(summary.second);
+	}
+
+	return results;
+}
@@ -21,6 +21,7 @@ Projectile::Projectile(const Projectile& source) : GraphicObject(source)
 Projectile::Projectile(const GraphicAssetInfo& media) : GraphicObject(media)
 {
 	_destructionController->SetDestructionTime(_destructionTime);
+	_sceneComponents = SceneComponents::MOTION | SceneComponents::ANIMATION | SceneComponents::LIFETIME; //Projectiles are numerous enough to be worth updating in bulk
 
 	static const std::shared_ptr<GraphicObject> redParticles = std::make_shared<GraphicObject>(Resources::Graphics::RED_DIRECTED_PARTICLES, 1);
 	_destructionParticlesPrototype = redParticles;
@@ -49,6 +50,29 @@ std::shared_ptr<Projectile> Projectile::Clone(const Vector2& position) const
 	return clone;
 }
 
+/*
+	Description:
+		Brings a spent Projectile back to the state Clone would have created it in, reusing its components
+		instead of allocating new ones. Only valid for Projectiles that were cloned from the same prototype
+		and are no longer part of the scene.
+
+	Arguments:
+		prototype - The Projectile this one was originally cloned from
+		position - Where the Projectile starts in world coordinates
+*/
+void Projectile::Rearm(const Projectile& prototype, const Vector2& position)
+{
+	*_transform = *prototype._transform;
+	_transform->_Collider.SetAssociatedRigidBody(&_transform->_RigidBody);
+	*_graphicsController = *prototype._graphicsController;
+	_destructionController->Reset();
+	*_destructionController = *prototype._destructionController;
+	_observerController.ClearObservers(); //Added again when it rejoins the scene
+
+	SetPosition(position);
+	SetIsActive(true);
+}
+
 /*
 	Description:
 		Applies an impulse velocity to the Projectile in the specified direction.
@@ -66,8 +90,9 @@ void Projectile::Fire(const Vector2& direction)
 
 /*
 	Description:
-		Updates the transform and checks whether or not the Projectile is ready to be destroyed.
+		Checks whether or not the Projectile is ready to be destroyed.
 		Default behavior for Projectiles is to destroy them on collision with any object.
+		Projectiles that survive are moved afterwards by SceneComponents.
 
 	Arguments:
 		playerInfo - Information about the Player during this frame.
@@ -79,15 +104,7 @@ void Projectile::Update(const PlayerInfo& playerInfo, const Vector2& cameraPosit
 	GraphicObject::Update(playerInfo, cameraPosition, input);
 
 	if (_transform->_Collider.GetCollisionResponseInfo()._IsColliding)
-	{
 		Destroy();
-	}
-	else
-	{
-		_transform->ResolveCollisions();
-		const Vector2 displacement = _transform->_RigidBody.ApplyMovementForces();
-		_transform->Move(displacement);
-	}
 }
 
 ColliderInterface* Projectile::GetCollider()
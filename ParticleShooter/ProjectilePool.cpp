@@ -0,0 +1,61 @@
+#include "ProjectilePool.h"
+#include "Stats.h"
+
+#include <algorithm>
+
+int ProjectilePool::TOTAL_POOLED = 0;
+int ProjectilePool::LARGEST_POOL = 0;
+
+ProjectilePool::ProjectilePool(std::shared_ptr<const Projectile> prototype) : _prototype(prototype)
+{
+}
+
+ProjectilePool::~ProjectilePool()
+{
+	TOTAL_POOLED -= GetSize(); //Reported on the next Acquire. Pools can outlive Stats when they belong to static prototypes
+}
+
+/*
+	Description:
+		Hands out an active Projectile at the given position, ready to be added to the scene and fired.
+		Re-arms a free pooled Projectile when there is one, otherwise grows the pool with a new clone.
+
+	Arguments:
+		position - Where the Projectile starts in world coordinates
+
+	Return:
+		std::shared_ptr<Projectile> - Shared with the pool, which takes it back once every other owner has released it
+*/
+std::shared_ptr<Projectile> ProjectilePool::Acquire(const Vector2& position)
+{
+	Stats& stats = Stats::GetInstance();
+	std::shared_ptr<Projectile> projectile = nullptr;
+
+	for (size_t i = 0; i < _projectiles.size() && projectile == nullptr; i++)
+	{
+		const size_t candidate = (_nextCandidate + i) % _projectiles.size();
+		if (_projectiles[candidate].use_count() != 1)
+			continue;
+
+		projectile = _projectiles[candidate];
+		projectile->Rearm(*_prototype, position);
+		_nextCandidate = (candidate + 1) % _projectiles.size();
+		stats.Increment(StatCounter::PROJECTILES_RECYCLED);
+	}
+
+	if (projectile == nullptr)
+	{
+		projectile = _prototype->Clone(position);
+		_projectiles.push_back(projectile);
+		_nextCandidate = 0; //The oldest shots are the next to expire
+		stats.Increment(StatCounter::PROJECTILES_CREATED);
+
+		TOTAL_POOLED++;
+		LARGEST_POOL = std::max(LARGEST_POOL, GetSize());
+	}
+
+	stats.Set(StatCounter::PROJECTILE_POOL_SIZE, TOTAL_POOLED);
+	stats.Set(StatCounter::PROJECTILE_POOL_HIGH_WATER, LARGEST_POOL);
+
+	return projectile;
+}
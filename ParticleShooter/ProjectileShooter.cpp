@@ -2,14 +2,17 @@
 #include "GameObjectRegistryService.h"
 #include "ProjectileShooter.h"
 
-ProjectileShooter::ProjectileShooter(std::shared_ptr<const Projectile> projectileType, const bool& shouldDelay) : _shouldDelay(shouldDelay), _projectilePrototype(projectileType) {}
+ProjectileShooter::ProjectileShooter(std::shared_ptr<const Projectile> projectileType, const bool& shouldDelay) : _shouldDelay(shouldDelay), _projectilePrototype(projectileType)
+{
+	_pool = std::make_shared<ProjectilePool>(projectileType);
+}
 
-ProjectileShooter::ProjectileShooter(const ProjectileShooter& source) : _shouldDelay(source._shouldDelay), _projectilePrototype(source._projectilePrototype) {}
+ProjectileShooter::ProjectileShooter(const ProjectileShooter& source) : _shouldDelay(source._shouldDelay), _projectilePrototype(source._projectilePrototype), _pool(source._pool) {}
 
 /*
 	Description:
 		Ensures that the shooter has been delayed long enough. If so,
-		Spawns a copy of _projectilePrototype and "Fires" it (applies velocity)
+		Spawns a copy of _projectilePrototype from the pool and "Fires" it (applies velocity)
 		
 	Arguments:
 		position - The position to spawn the Projectile at
@@ -20,7 +23,7 @@ void ProjectileShooter::Shoot(const Vector2& position, const Vector2& direction)
 	const bool enoughTimeHasPassed = (_delayTimer.GetActive() && _delayTimer.GetSeconds() > _delay) || !_shouldDelay;
 	if (!_delayTimer.GetActive() || enoughTimeHasPassed)
 	{
-		std::shared_ptr<Projectile> projectile = _projectilePrototype->Clone(position);
+		std::shared_ptr<Projectile> projectile = _pool->Acquire(position);
 		GameObjectRegistryLocator::GetCreatorService()->AddGameObjectToScene(projectile);
 
 		projectile->Fire(direction);
@@ -1,38 +1,24 @@
 #include "PropertyController.h"
 #include "ErrorHandler.h"
 
-int PropertyController::GetPropertyValue(const Property& propertyId) const
-{
-	if (_propertyMap.find(propertyId) == _propertyMap.end())
-	{
-		ErrorHandler::Assert(false, "Asked for a property which has not yet been assigned.");
-		return 0;
-	}
-
-	return _propertyMap.at(propertyId);
-}
-
 /*
 	Description:
-		If a propertyId is not found in the _propertyMap, a new one is created. Otherwise,
-		the old value is overwritten
+		Takes on the source's values. The version moves forward rather than being copied, so anything
+		caching against this controller's old version sees the change.
 */
-void PropertyController::SetPropertyValue(const Property& propertyId, const int& value)
+PropertyController& PropertyController::operator=(const PropertyController& source)
 {
-	if (_propertyMap.find(propertyId) == _propertyMap.end())
-	{
-		_propertyMap.insert({ propertyId, value });
-		return;
-	}
+	if (this == &source)
+		return *this;
 
-	_propertyMap[propertyId] = value;
+	_values = source._values;
+	_assigned = source._assigned;
+	_version++;
+	return *this;
 }
 
-bool PropertyController::ComparePropertyValue(const Property& propertyId, const int& value) const
+int PropertyController::ReportUnassigned()
 {
-	const int currentValue = GetPropertyValue(propertyId);
-	if (currentValue == value)
-		return true;
-
-	return false;
-}
\ No newline at end of file
+	ErrorHandler::Assert(false, "Asked for a property which has not yet been assigned.");
+	return 0;
+}
@@ -0,0 +1,279 @@
+#include "ErrorHandler.h"
+#include "Profiler.h"
+#include "RenderThread.h"
+
+#include <SDL_render.h>
+#include <string>
+
+RenderThread::RenderThread(SDL_Window* window, const RenderingBackend& backend) : _sdlWindow(window), _backend(backend)
+{
+}
+
+RenderThread::~RenderThread()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _running = false;
+    }
+    _workAvailable.notify_all();
+
+    if (_thread.joinable())
+        _thread.join();
+}
+
+/*
+    Description:
+        Launches the render thread and waits for it to create its SDL_Renderer
+
+    Return:
+        bool - Whether or not the SDL_Renderer was created. If false, nothing will render to the screen
+*/
+bool RenderThread::Start()
+{
+    _running = true;
+    _thread = std::thread(&RenderThread::Run, this);
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    _workCompleted.wait(lock, [this] { return _started; });
+    return _running;
+}
+
+RenderSnapshot& RenderThread::BeginSnapshot()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _snapshots.at(_writeIndex);
+}
+
+/*
+    Description:
+        Swaps the recorded snapshot into the ready slot. If the render thread hasn't picked up the previous ready
+        snapshot yet, that one is dropped and recycled as the next snapshot to record into.
+*/
+void RenderThread::SubmitSnapshot()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::swap(_writeIndex, _readyIndex);
+        _snapshotReady = true;
+    }
+    _workAvailable.notify_one();
+}
+
+SDL_Texture* RenderThread::CreateTexture(SDL_Surface* surface)
+{
+    TextureRequest request;
+    request._Surface = surface;
+    return SubmitTextureRequest(request);
+}
+
+SDL_Texture* RenderThread::CreateTexture(const void* pixels, const int width, const int height, const int pitch, const Uint32 pixelFormat)
+{
+    TextureRequest request;
+    request._Pixels = pixels;
+    request._Width = width;
+    request._Height = height;
+    request._Pitch = pitch;
+    request._PixelFormat = pixelFormat;
+    return SubmitTextureRequest(request);
+}
+
+/*
+    Description:
+        Queues a texture to be destroyed once the render thread has finished drawing the snapshot it is working on.
+        Textures queued after the render thread has stopped were already freed along with the SDL_Renderer.
+
+    Arguments:
+        texture - The SDL_Texture that is no longer referenced by the simulation
+*/
+void RenderThread::DestroyTexture(SDL_Texture* texture)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_running && texture != nullptr)
+        _texturesToDestroy.push_back(texture);
+}
+
+/*
+    Description:
+        Hands a texture request to the render thread and blocks until it has been fulfilled.
+
+    Arguments:
+        request - Description of the pixels to upload. Filled in with the resulting SDL_Texture
+
+    Return:
+        SDL_Texture* - The new texture. nullptr if it couldn't be created or the render thread isn't running
+*/
+SDL_Texture* RenderThread::SubmitTextureRequest(TextureRequest& request)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (!_running)
+        return nullptr;
+
+    _textureRequests.push_back(&request);
+    _workAvailable.notify_one();
+    _workCompleted.wait(lock, [&request] { return request._Completed; });
+
+    return request._Result;
+}
+
+/*
+    Description:
+        The render thread's main loop. Sleeps until there is work, then services texture requests,
+        draws and presents the latest snapshot, and frees any textures that snapshot was still allowed to use.
+*/
+void RenderThread::Run()
+{
+    _sdlRenderer = CreateSDLRenderer();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _running = _sdlRenderer != nullptr;
+        _started = true;
+    }
+    _workCompleted.notify_all();
+
+    std::vector<TextureRequest*> textureRequests;
+    std::vector<SDL_Texture*> texturesToDestroy;
+    while (true)
+    {
+        bool drawSnapshot = false;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _workAvailable.wait(lock, [this] { return !_running || _snapshotReady || !_textureRequests.empty(); });
+            if (!_running)
+                break;
+
+            textureRequests.swap(_textureRequests);
+
+            if (_snapshotReady)
+            {
+                std::swap(_readIndex, _readyIndex);
+                _snapshotReady = false;
+                drawSnapshot = true;
+
+                //Anything released before this point can't be referenced by snapshots recorded afterwards
+                texturesToDestroy.swap(_texturesToDestroy);
+            }
+        }
+
+        ProcessTextureRequests(textureRequests);
+
+        if (drawSnapshot)
+            Draw(_snapshots.at(_readIndex));
+
+        for (SDL_Texture* texture : texturesToDestroy)
+            SDL_DestroyTexture(texture);
+        texturesToDestroy.clear();
+    }
+
+    //Shutting down. Release anyone still waiting on a texture and free everything the renderer owns
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (TextureRequest* request : _textureRequests)
+            request->_Completed = true;
+        _textureRequests.clear();
+        texturesToDestroy.swap(_texturesToDestroy);
+    }
+    _workCompleted.notify_all();
+
+    for (SDL_Texture* texture : texturesToDestroy)
+        SDL_DestroyTexture(texture);
+
+    if (_sdlRenderer != nullptr)
+        SDL_DestroyRenderer(_sdlRenderer);
+    _sdlRenderer = nullptr;
+
+    if (_offscreenSurface != nullptr)
+        SDL_FreeSurface(_offscreenSurface);
+    _offscreenSurface = nullptr;
+}
+
+/*
+    Description:
+        Creates the SDL_Renderer for the chosen backend. Called from the render thread, which owns it from then on.
+
+    Return:
+        SDL_Renderer* - The new renderer. nullptr if it couldn't be created
+*/
+SDL_Renderer* RenderThread::CreateSDLRenderer()
+{
+    if (_backend != RenderingBackend::SOFTWARE)
+        return SDL_CreateRenderer(_sdlWindow, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+
+    //Rasterize on the CPU into a screen sized surface nobody looks at. Same draw calls, no GPU, no vsync
+    _offscreenSurface = SDL_CreateRGBSurfaceWithFormat(0, SCREEN_WIDTH, SCREEN_HEIGHT, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (_offscreenSurface == nullptr)
+        return nullptr;
+
+    return SDL_CreateSoftwareRenderer(_offscreenSurface);
+}
+
+/*
+    Description:
+        Creates the SDL_Textures for every pending request and wakes up the threads waiting on them.
+
+    Arguments:
+        requests - The requests taken off of the queue. Emptied once every request is completed
+*/
+void RenderThread::ProcessTextureRequests(std::vector<TextureRequest*>& requests)
+{
+    if (requests.empty())
+        return;
+
+    ProfileZone zone("RenderThread/Textures");
+
+    for (TextureRequest* request : requests)
+    {
+        SDL_Texture* sdlTexture = nullptr;
+        if (request->_Surface != nullptr)
+        {
+            sdlTexture = SDL_CreateTextureFromSurface(_sdlRenderer, request->_Surface);
+        }
+        else
+        {
+            sdlTexture = SDL_CreateTexture(_sdlRenderer, request->_PixelFormat, SDL_TEXTUREACCESS_STATIC, request->_Width, request->_Height);
+            if (sdlTexture != nullptr)
+            {
+                SDL_UpdateTexture(sdlTexture, nullptr, request->_Pixels, request->_Pitch);
+                SDL_SetTextureBlendMode(sdlTexture, SDL_BLENDMODE_BLEND); //Matches SDL_CreateTextureFromSurface for color keyed surfaces
+            }
+        }
+
+        ErrorHandler::Assert(sdlTexture != nullptr, "Unable to create texture. SDL Error: " + std::string(SDL_GetError()));
+        request->_Result = sdlTexture;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (TextureRequest* request : requests)
+            request->_Completed = true;
+    }
+    _workCompleted.notify_all();
+
+    requests.clear();
+}
+
+/*
+    Description:
+        Replays a snapshot's commands onto the SDL_Renderer and presents the result. Blocks on vsync.
+
+    Arguments:
+        snapshot - The frame to draw. Not modified by the simulation while it is being drawn
+*/
+void RenderThread::Draw(const RenderSnapshot& snapshot)
+{
+    {
+        ProfileZone zone("RenderThread/Draw");
+
+        SDL_SetRenderDrawColor(_sdlRenderer, 0, 0, 0, 255);
+        SDL_RenderClear(_sdlRenderer);
+
+        for (const SpriteCommand& sprite : snapshot._Sprites)
+            SDL_RenderCopyEx(_sdlRenderer, sprite._Texture, &sprite._SourceRect, &sprite._DestinationRect, sprite._Angle, &sprite._RotationCenter, sprite._Flip);
+
+        SDL_SetRenderDrawColor(_sdlRenderer, 0xFF, 0x00, 0x00, 0xFF); //Debug lines are drawn in Red
+        for (const LineCommand& line : snapshot._Lines)
+            SDL_RenderDrawLine(_sdlRenderer, line._Start.x, line._Start.y, line._End.x, line._End.y);
+    }
+
+    ProfileZone zone("RenderThread/Present");
+    SDL_RenderPresent(_sdlRenderer);
+}
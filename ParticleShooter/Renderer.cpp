@@ -1,29 +1,36 @@
+#include "AssetBundle.h"
 #include "Common.h"
 #include "ErrorHandler.h"
 #include "GraphicsController.h"
 #include "Renderer.h"
+#include "Stats.h"
 #include "StringResources.h"
 #include "Transform.h"
 
+#include <algorithm>
 #include <SDL_events.h>
 #include <SDL_image.h>
 #include <SDL_render.h>
 
-SDL_Renderer* Renderer::SDL_RENDERER = nullptr;
+RenderThread* Renderer::RENDER_THREAD = nullptr;
+RenderingBackend Renderer::BACKEND = RenderingBackend::ACCELERATED;
 
-Renderer::Renderer(std::shared_ptr<const ScrollingCamera> camera)
+Renderer::Renderer(std::shared_ptr<const ScrollingCamera> camera, const RenderingBackend& backend)
 {
     _camera = camera;
+    BACKEND = backend;
     ErrorHandler::Assert(Initialize(), "Renderer failed to initialize"); //Sets up the SDL specific rendering and graphics code
 
 }
 
 Renderer::~Renderer()
 {
-    SDL_DestroyRenderer(SDL_RENDERER);
-    SDL_DestroyWindow(sdlWindow);
+    //Stopping the render thread frees the SDL_Renderer along with every texture it still owns
+    RENDER_THREAD = nullptr;
+    _renderThread.reset();
+    if (sdlWindow != nullptr)
+        SDL_DestroyWindow(sdlWindow);
 
-    SDL_RENDERER = nullptr;
     sdlWindow = nullptr;
 
     IMG_Quit();
@@ -31,15 +38,20 @@ Renderer::~Renderer()
 
 /*
     Description:
-        Creates and SDL_Window and SDL_Renderer in which this class acts as a Wrapper for.
+        Creates and SDL_Window and starts the RenderThread which creates the SDL_Renderer this class acts as a Wrapper for.
         Required to draw to the screen using SDL's APIs.
         Required to create SDL_Textures.
 
+        The SOFTWARE and NONE backends skip the window entirely. NONE doesn't start a RenderThread either.
+
     Return:
         bool - Whether or not the Renderer initialization was successful. If false, nothing will render to the screen
 */
 bool Renderer::Initialize()
 {
+    if (BACKEND != RenderingBackend::ACCELERATED)
+        return InitializeOffscreen();
+
     bool successfulInitialization = true;
 
     if (SDL_Init(SDL_INIT_VIDEO) < 0) //Needed to setup the entire graphics system
@@ -59,23 +71,72 @@ bool Renderer::Initialize()
                 SDL_SetWindowFullscreen(sdlWindow, 1);
                 SDL_ShowCursor(0); //Hide OS cursor in favor of our own custom cursor
 
-                SDL_RENDERER = SDL_CreateRenderer(sdlWindow, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
-                if (SDL_RENDERER == nullptr)
+                _renderThread = std::make_unique<RenderThread>(sdlWindow);
+                if (!_renderThread->Start()) //The render thread creates and owns the SDL_Renderer
+                {
+                    _renderThread.reset(); //Frames keep being recorded into the headless snapshot and thrown away
                     successfulInitialization =  false;
+                }
                 else
                 {
                     if (!IMG_Init(IMG_INIT_PNG)) //Initializating the image libraries that are used for PNGs specifically
                         successfulInitialization = false;
+
+                    AssetBundle::GetInstance().Open(Resources::Strings::ASSET_BUNDLE); //Optional. Without a bundle, Textures are decoded from the loose pngs
+                    RENDER_THREAD = _renderThread.get();
+                    _snapshot = &_renderThread->BeginSnapshot();
                 }
             }
         }
     }
 
-    ClearScreen();
-    SwapFrameBuffers();
+    if (successfulInitialization)
+    {
+        ClearScreen();
+        SwapFrameBuffers();
+    }
     return successfulInitialization;
 }
 
+/*
+    Description:
+        Initialization for runs without a window (benchmarks, CI). Only the event subsystem is started so input
+        can still be polled. The SOFTWARE backend starts a RenderThread which draws into an offscreen surface,
+        the NONE backend records every frame into a snapshot that is thrown away on SwapFrameBuffers.
+
+    Return:
+        bool - Whether or not the Renderer initialization was successful
+*/
+bool Renderer::InitializeOffscreen()
+{
+    if (SDL_Init(SDL_INIT_EVENTS) < 0)
+        return false;
+
+    if (!IMG_Init(IMG_INIT_PNG)) //Textures are still decoded to learn their dimensions
+        return false;
+
+    AssetBundle::GetInstance().Open(Resources::Strings::ASSET_BUNDLE);
+
+    if (BACKEND == RenderingBackend::SOFTWARE)
+    {
+        _renderThread = std::make_unique<RenderThread>(nullptr, BACKEND);
+        if (!_renderThread->Start())
+        {
+            _renderThread.reset();
+            return false;
+        }
+
+        RENDER_THREAD = _renderThread.get();
+        _snapshot = &_renderThread->BeginSnapshot();
+    }
+    else
+    {
+        _snapshot = &_headlessSnapshot;
+    }
+
+    return true;
+}
+
 /*
     Description:
         Coordinate space transformation from Model to Camera space
@@ -115,13 +176,13 @@ Vector2 Renderer::ConvertPointFromModelToCameraSpace(const Vector2 point, const
     Return:
         Vector2 - The texture's Camera Space position. Ready for rendering
 */
-Vector2 Renderer::CalculateCameraCoordinatesForTexture(const std::shared_ptr<const Texture>& texture, const Vector2& worldSpacePosition, const Vector2& additionalOffset) const
+Vector2 Renderer::CalculateCameraCoordinatesForTexture(const Texture& texture, const Vector2& worldSpacePosition, const Vector2& additionalOffset) const
 {
     Vector2 texturePosition = worldSpacePosition;
-    texturePosition = texturePosition + texture->GetOffset(); //Factor in the position offset unique to the texture itself
+    texturePosition = texturePosition + texture.GetOffset(); //Factor in the position offset unique to the texture itself
     texturePosition = texturePosition + additionalOffset; //Any addition drawing offsets. Possibly due to screen effects like screen shake
 
-    const Vector2 parallaxedCameraPosition = _camera->GetPosition() * texture->GetParallax(); //The the camera's parallaxed position in world space
+    const Vector2 parallaxedCameraPosition = _cameraPosition * texture.GetParallax(); //The the camera's parallaxed position in world space
     texturePosition = texturePosition - parallaxedCameraPosition; //World -> Camera coordinate transform
 
     return texturePosition;
@@ -137,18 +198,18 @@ Vector2 Renderer::CalculateCameraCoordinatesForTexture(const std::shared_ptr<con
 */
 void Renderer::Render(const std::vector<Vector2>& points, const Vector2& origin)
 {
-    SDL_SetRenderDrawColor(SDL_RENDERER, 0xFF, 0x00, 0x00, 0xFF); //Draw in Red
     for (int i = 0; i < points.size(); i++)
     {
         //Draw the single point
         const Vector2 position = ConvertPointFromModelToCameraSpace(points.at(i), origin);
-        SDL_RenderDrawPoint(SDL_RENDERER, position.x, position.y);
+        const SDL_Point point = { static_cast<int>(position.x), static_cast<int>(position.y) };
+        _snapshot->_Lines.push_back({ point, point });
 
         //Check to see if there is a point afterwards, if so, draw a line between the two points
         if (i + 1 < points.size())
         {
             const Vector2 nextPosition = ConvertPointFromModelToCameraSpace(points.at(i + 1), origin);
-            SDL_RenderDrawLine(SDL_RENDERER, position.x, position.y, nextPosition.x, nextPosition.y);
+            _snapshot->_Lines.push_back({ point, { static_cast<int>(nextPosition.x), static_cast<int>(nextPosition.y) } });
         }
     }
 
@@ -157,7 +218,7 @@ void Renderer::Render(const std::vector<Vector2>& points, const Vector2& origin)
     {
         const Vector2 position = ConvertPointFromModelToCameraSpace(points.at(points.size() - 1), origin);
         const Vector2 nextPosition = ConvertPointFromModelToCameraSpace(points.at(0), origin);
-        SDL_RenderDrawLine(SDL_RENDERER, position.x, position.y, nextPosition.x, nextPosition.y);
+        _snapshot->_Lines.push_back({ { static_cast<int>(position.x), static_cast<int>(position.y) }, { static_cast<int>(nextPosition.x), static_cast<int>(nextPosition.y) } });
     }
 }
 
@@ -178,48 +239,148 @@ void Renderer::Render(const std::shared_ptr<const Transform>& transform, const s
     //Updates _renderingEffectOffset to match the current effect offset for the given layer
     UpdateRenderingEffectOffset(graphicsController->GetRenderingLayer());
 
-    for (const std::shared_ptr<const Texture>& texture : graphicsController->GetCurrentTextures())
+    //Draw the object and camera between their last two simulated poses so rendering isn't tied to the fixed update rate
+    const float interpolation = GetLayerInterpolation(graphicsController->GetRenderingLayer());
+    _cameraPosition = _camera->GetInterpolatedPosition(interpolation);
+    const Vector2 worldSpacePosition = transform->GetInterpolatedOrigin(interpolation);
+    const double orientationAngle = transform->GetInterpolatedOrientationAngle(interpolation);
+
+    for (const Texture* texture : graphicsController->GetCurrentTextures())
+    {
+        if (!_drawParallaxLayers && texture != nullptr && texture->GetParallax() != 1.0f)
+            continue;
+
+        RenderTexture(worldSpacePosition, orientationAngle, texture);
+    }
+}
+
+/*
+    Description:
+        Renders every live particle of an emitter as one batch. Particles don't move, so only the
+        camera is interpolated, and the layer's effect offset is shared by the whole batch.
+
+    Arguments:
+        emitter - The pool of particles to draw, oldest first
+*/
+void Renderer::Render(const ParticleEmitter& emitter)
+{
+    UpdateRenderingEffectOffset(emitter.GetRenderingLayer());
+    _cameraPosition = _camera->GetInterpolatedPosition(GetLayerInterpolation(emitter.GetRenderingLayer()));
+
+    std::vector<SpriteCommand>& sprites = _snapshot->_Sprites;
+    sprites.reserve(sprites.size() + emitter.GetCount());
+
+    for (int i = 0; i < emitter.GetCount(); i++)
     {
-        RenderTexture(*(transform.get()), texture);
+        const int index = emitter.GetIndex(i);
+        const Texture* texture = emitter.GetFrame(index);
+        const Vector2 texturePosition = CalculateCameraCoordinatesForTexture(*texture, emitter.GetPosition(index), _renderingEffectOffset);
+
+        SpriteCommand sprite;
+        sprite._Texture = texture->GetSDLTexture();
+        sprite._RotationCenter = texture->GetRotationOffset();
+        sprite._SourceRect = texture->GetSDLRect();
+        sprite._DestinationRect = sprite._SourceRect;
+        sprite._DestinationRect.x = texturePosition.x;
+        sprite._DestinationRect.y = texturePosition.y;
+        sprite._Angle = emitter.GetAngle(index);
+        sprite._Flip = texture->GetFlipMode();
+
+        if (IsOnScreen(sprite._DestinationRect, sprite._Angle))
+            sprites.push_back(sprite);
     }
 }
 
 /*
     Description:
-        Renders a single texture the SDL way. The function converts how texture info to match
+        Records a single texture the SDL way. The function converts how texture info to match
         what is expected by the SDL renderer. 
 
     Arguments:
-        transform - The transform associated with the GC. Tells us the World coordinate position
+        worldSpacePosition - Where the texture's owner should be drawn in World coordinates
+        orientationAngle - Rotation of the texture's owner. Clockwise is positive
         texture - The texture being drawn
 */
-void Renderer::RenderTexture(const Transform& transform, const std::shared_ptr<const Texture>& texture) const
+void Renderer::RenderTexture(const Vector2& worldSpacePosition, const double& orientationAngle, const Texture* texture) const
 {
     if (texture == nullptr)
         return;
 
-    const SDL_Point rotationCenter = texture->GetRotationOffset(); //The model space point where the texture is rotated 
-    const Vector2 texturePosition = CalculateCameraCoordinatesForTexture(texture, transform.GetOrigin(), _renderingEffectOffset);
-    const SDL_Rect sourceRect = texture->GetSDLRect(); //The model space bounding rect
-    SDL_Rect destinationRect = sourceRect; //The camera space bounding rect
+    const Vector2 texturePosition = CalculateCameraCoordinatesForTexture(*texture, worldSpacePosition, _renderingEffectOffset);
+
+    SpriteCommand sprite;
+    sprite._Texture = texture->GetSDLTexture();
+    sprite._RotationCenter = texture->GetRotationOffset(); //The model space point where the texture is rotated 
+    sprite._SourceRect = texture->GetSDLRect(); //The model space bounding rect
+    sprite._DestinationRect = sprite._SourceRect; //The camera space bounding rect
+    sprite._DestinationRect.x = texturePosition.x;
+    sprite._DestinationRect.y = texturePosition.y;
+    sprite._Angle = orientationAngle;
+    sprite._Flip = texture->GetFlipMode();
+
+    //Drawn later by the render thread. Anything off screen would only cost the render thread time to clip away
+    if (IsOnScreen(sprite._DestinationRect, sprite._Angle))
+        _snapshot->_Sprites.push_back(sprite);
+}
 
-    destinationRect.x = texturePosition.x;
-    destinationRect.y = texturePosition.y;
+/*
+    Description:
+        Conservative visibility test for a texture about to be drawn.
 
-    //SDL rendering call
-    SDL_RenderCopyEx(SDL_RENDERER, texture->GetSDLTexture(), &sourceRect, &destinationRect, transform.GetOrientationAngle(), &rotationCenter, texture->GetFlipMode());
-}
+    Arguments:
+        cameraSpaceRect - Where the texture will be drawn on screen before rotation
+        orientationAngle - The rotation the texture will be drawn with
 
+    Return:
+        bool - False only if no part of the texture can land on the screen
+*/
+bool Renderer::IsOnScreen(const SDL_Rect& cameraSpaceRect, const double& orientationAngle) const
+{
+    //Rotated textures can reach past their unrotated bounds. Padding by the larger dimension covers any rotation point within the texture
+    const int padding = orientationAngle != 0.0 ? static_cast<int>(std::max(cameraSpaceRect.w, cameraSpaceRect.h) * _cullingMargin) : 0;
 
+    return cameraSpaceRect.x + cameraSpaceRect.w + padding > 0 && cameraSpaceRect.x - padding < SCREEN_WIDTH
+        && cameraSpaceRect.y + cameraSpaceRect.h + padding > 0 && cameraSpaceRect.y - padding < SCREEN_HEIGHT;
+}
+
+/*
+    Description:
+        Starts recording a new frame. The render thread clears the screen to black before drawing it.
+*/
 void Renderer::ClearScreen()
 {
-    SDL_SetRenderDrawColor(SDL_RENDERER, 0, 0, 0, 255);
-    SDL_RenderClear(SDL_RENDERER);
+    _snapshot->Clear();
 }
 
+/*
+    Description:
+        Hands the recorded frame over to the render thread to be drawn and presented, and
+        starts recording into the next free snapshot. Doesn't wait on vsync.
+*/
 void Renderer::SwapFrameBuffers()
 {
-    SDL_RenderPresent(SDL_RENDERER);
+    //Sprites are drawn in submission order, so a bind happens whenever the texture differs from the previous sprite's
+    int textureBinds = 0;
+    const SDL_Texture* boundTexture = nullptr;
+    for (const SpriteCommand& sprite : _snapshot->_Sprites)
+    {
+        if (sprite._Texture != boundTexture)
+            textureBinds++;
+        boundTexture = sprite._Texture;
+    }
+
+    Stats& stats = Stats::GetInstance();
+    stats.Increment(StatCounter::DRAW_CALLS, static_cast<int>(_snapshot->_Sprites.size() + _snapshot->_Lines.size()));
+    stats.Increment(StatCounter::TEXTURE_BINDS, textureBinds);
+
+    if (_renderThread == nullptr) //Headless. Nothing is ever drawn
+    {
+        _snapshot->Clear();
+        return;
+    }
+
+    _renderThread->SubmitSnapshot();
+    _snapshot = &_renderThread->BeginSnapshot();
 }
 
 /*
@@ -239,7 +400,23 @@ void Renderer::UpdateRenderingEffectOffset(const RenderingLayer& renderingLayer)
     if (!_screenShake || renderingLayer == RenderingLayer::UI)
         _renderingEffectOffset = Vector2(0, 0);
     else
-        _renderingEffectOffset = CommonHelpers::RandomOffset(_screenShakeMagnitude);
+        _renderingEffectOffset = CommonHelpers::RandomOffset(_screenShakeMagnitude, _screenShakeRandom);
+}
+
+/*
+    Description:
+        The UI layer is pinned to the camera every simulation tick. Drawing it with the latest state of both
+        keeps it perfectly still on screen, every other layer is interpolated.
+
+    Arguments:
+        renderingLayer - The Layer which is about to be rendered
+
+    Return:
+        float - The interpolation factor to draw the layer with
+*/
+float Renderer::GetLayerInterpolation(const RenderingLayer& renderingLayer) const
+{
+    return renderingLayer == RenderingLayer::UI ? 1.0f : _interpolation;
 }
 
 /*
@@ -277,12 +454,21 @@ void Renderer::SetScreenShake(const bool active)
 bool Renderer::CreateTextureFromFile(Texture& newTexture, const std::string& filePath)
 {
     SDL_Texture* sdlTexture = nullptr;
-    SDL_Surface* loadedSurface = IMG_Load(filePath.c_str());
+    SDL_Surface* loadedSurface = IMG_Load(filePath.c_str()); //Decoding happens on the calling thread. Only the upload waits on the render thread
 
     ErrorHandler::Assert(loadedSurface != nullptr, "Unable to load image from: " + filePath + ". SDL_image Error: " + IMG_GetError());
+    if (BACKEND == RenderingBackend::NONE && loadedSurface != nullptr) //Headless. Collision and layout only need the dimensions
+    {
+        newTexture.SetWidth(loadedSurface->w);
+        newTexture.SetHeight(loadedSurface->h);
+        SDL_FreeSurface(loadedSurface);
+        return true;
+    }
+
+    ErrorHandler::Assert(RENDER_THREAD != nullptr, "Textures can't be created before the Renderer is initialized: " + filePath);
     
     SDL_SetColorKey(loadedSurface, SDL_TRUE, SDL_MapRGB(loadedSurface->format, 0, 0xFF, 0xFF));
-    sdlTexture = SDL_CreateTextureFromSurface(SDL_RENDERER, loadedSurface);
+    sdlTexture = RENDER_THREAD->CreateTexture(loadedSurface);
 
     ErrorHandler::Assert(sdlTexture != nullptr, "Unable to create texture from: " + filePath + ". SDL Error: " + SDL_GetError());
     newTexture.SetWidth(loadedSurface->w);
@@ -292,4 +478,54 @@ bool Renderer::CreateTextureFromFile(Texture& newTexture, const std::string& fil
 
     newTexture.SetSDLTexture(sdlTexture);
     return sdlTexture != nullptr;
-}
\ No newline at end of file
+}
+
+/*
+    Description:
+        Creates a SDL_Texture from already decoded pixels (typically memory mapped from the AssetBundle)
+        and sets it up properly in the given Texture wrapper. Any color keying must already be baked into the alpha channel.
+
+    Arguments:
+        newTexture - The empty Texture wrapper which will become the new home for the constructed SDL_Texture
+        pixels - The first pixel of the image. Only read during this call
+        width - Width of the image in pixels
+        height - Height of the image in pixels
+        pitch - Number of bytes in a single row of pixels
+        pixelFormat - The SDL_PixelFormatEnum that pixels are stored in
+
+    Output:
+		Texture& - Updated Texture object that holds an SDL_Texture representation of the pixels
+*/
+bool Renderer::CreateTextureFromPixels(Texture& newTexture, const void* pixels, const int width, const int height, const int pitch, const Uint32 pixelFormat)
+{
+    if (BACKEND == RenderingBackend::NONE) //Headless. Collision and layout only need the dimensions
+    {
+        newTexture.SetWidth(width);
+        newTexture.SetHeight(height);
+        return true;
+    }
+
+    ErrorHandler::Assert(RENDER_THREAD != nullptr, "Textures can't be created before the Renderer is initialized");
+
+    SDL_Texture* sdlTexture = RENDER_THREAD->CreateTexture(pixels, width, height, pitch, pixelFormat);
+    ErrorHandler::Assert(sdlTexture != nullptr, "Unable to create texture from bundled pixels. SDL Error: " + std::string(SDL_GetError()));
+
+    newTexture.SetWidth(width);
+    newTexture.SetHeight(height);
+    newTexture.SetSDLTexture(sdlTexture);
+    return sdlTexture != nullptr;
+}
+
+/*
+    Description:
+        SDL_Textures may still be referenced by a snapshot the render thread hasn't drawn yet.
+        Destruction is handed to the render thread, which frees the texture once that snapshot is done.
+
+    Arguments:
+        sdlTexture - The texture which is no longer used by any Texture wrapper
+*/
+void Renderer::DestroyTexture(SDL_Texture* sdlTexture)
+{
+    if (RENDER_THREAD != nullptr) //Once the render thread has stopped, every texture was already freed alongside the SDL_Renderer
+        RENDER_THREAD->DestroyTexture(sdlTexture);
+}
@@ -0,0 +1,140 @@
+#include "ErrorHandler.h"
+#include "InputRecorder.h"
+#include "ReplayInputController.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <SDL_events.h>
+
+/*
+	Description:
+		Loads the whole recording and checks its header.
+
+	Arguments:
+		filePath - A recording written by InputRecorder
+*/
+ReplayInputController::ReplayInputController(const std::string& filePath)
+{
+	std::ifstream file(filePath, std::ios::binary);
+	_data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+	char magic[4] = {};
+	Uint8 version = 0;
+	Uint8 seedBytes[4] = {};
+	_loaded = Read(magic, sizeof(magic)) && std::memcmp(magic, InputRecorder::MAGIC, sizeof(magic)) == 0 &&
+		Read(&version, sizeof(version)) && version == InputRecorder::FORMAT_VERSION && Read(seedBytes, sizeof(seedBytes));
+	ErrorHandler::Assert(_loaded, "Unable to load the input recording: " + filePath);
+
+	_seed = seedBytes[0] | (seedBytes[1] << 8) | (seedBytes[2] << 16) | (static_cast<Uint32>(seedBytes[3]) << 24);
+	_finished = !_loaded;
+}
+
+//Advances the recording to the next tick
+void ReplayInputController::BeginFrame()
+{
+	if (_finished)
+		return;
+
+	if (_remainingRepeats > 0)
+		_remainingRepeats--;
+	else if (!ReadTick())
+		_finished = true;
+}
+
+/*
+	Description:
+		Recorded input ignores the live events apart from Escape, so the viewer can always leave a replay early.
+*/
+void ReplayInputController::UpdateEventStatus(bool& eventMarker, const InputEvent& inputEvent, const SDL_Event& polledSDLEvent)
+{
+	if (inputEvent == InputEvent::QUIT && polledSDLEvent.type == SDL_KEYDOWN && polledSDLEvent.key.keysym.sym == SDLK_ESCAPE)
+		_viewerQuit = true;
+}
+
+/*
+	Description:
+		Replaces the button state with the recorded one. The recorded quit is ignored, since the ticks recorded after it in
+		the same frame still need to be played. Quit is pressed instead once the recording runs out or the viewer presses Escape.
+*/
+void ReplayInputController::UpdateFrameStatus(bool& eventMarker, const InputEvent& inputEvent)
+{
+	if (inputEvent == InputEvent::QUIT)
+		eventMarker = _finished || _viewerQuit;
+	else
+		eventMarker = (InputRecorder::PackButtons(_currentState) >> inputEvent) & 1;
+}
+
+void ReplayInputController::UpdateCursorPosition(Vector2& vectorMarker)
+{
+	vectorMarker = _currentState._CursorPosition;
+}
+
+void ReplayInputController::UpdateMovementDirection(Vector2& vectorMarker)
+{
+	vectorMarker = _currentState._MovementDirection;
+}
+
+/*
+	Description:
+		Decodes the next record into _currentState.
+
+	Return:
+		bool - False once the recording has no more ticks, or is cut short
+*/
+bool ReplayInputController::ReadTick()
+{
+	Uint8 record = 0;
+	if (!Read(&record, sizeof(record)))
+		return false;
+
+	if (record & InputRecorder::REPEAT_FLAG)
+	{
+		//This tick is the first of the held ticks
+		_remainingRepeats = (record & InputRecorder::MAX_REPEAT) - 1;
+		return true;
+	}
+
+	if (record & InputRecorder::Change::BUTTONS)
+	{
+		Uint8 buttonBytes[2] = {};
+		if (!Read(buttonBytes, sizeof(buttonBytes)))
+			return false;
+		InputRecorder::UnpackButtons(static_cast<Uint16>(buttonBytes[0] | (buttonBytes[1] << 8)), _currentState);
+	}
+	if ((record & InputRecorder::Change::CURSOR) && !ReadVector(_currentState._CursorPosition))
+		return false;
+	if ((record & InputRecorder::Change::MOVEMENT) && !ReadVector(_currentState._MovementDirection))
+		return false;
+
+	return true;
+}
+
+//Copies the next bytes of the recording. Returns false without reading anything if there aren't enough left
+bool ReplayInputController::Read(void* destination, const size_t& size)
+{
+	if (_data.size() - _readOffset < size)
+		return false;
+
+	std::memcpy(destination, _data.data() + _readOffset, size);
+	_readOffset += size;
+	return true;
+}
+
+bool ReplayInputController::ReadVector(Vector2& vector)
+{
+	Uint8 bytes[8] = {};
+	if (!Read(bytes, sizeof(bytes)))
+		return false;
+
+	float components[2] = {};
+	for (int component = 0; component < 2; component++)
+	{
+		const Uint8* componentBytes = bytes + component * 4;
+		const Uint32 bits = componentBytes[0] | (componentBytes[1] << 8) | (componentBytes[2] << 16) | (static_cast<Uint32>(componentBytes[3]) << 24);
+		std::memcpy(&components[component], &bits, sizeof(bits));
+	}
+
+	vector = Vector2(components[0], components[1]);
+	return true;
+}
@@ -36,6 +36,9 @@ struct GraphicAssetInfo
 		: _FilePath(filePath), _TextureCount(count), _TextureScale(scale), _AnimationSpeed(speed),
 		_RenderingLayer(layer), _Looping(loop), _PercentageBased(percentBased), _FlipStyle(flip), _TextureOffset(offset), _TextureRotationOffset(rotationOffset) {}
 
+	//One shot animations that aren't part of the UI. These are spawned through a ParticleEmitter rather than as GameObjects
+	bool IsParticle() const { return !_Looping && !_PercentageBased && _RenderingLayer != RenderingLayer::UI; }
+
 	/* Texture File Information */
 	std::string _FilePath = "Assets/"; //The path where the graphic(s) can be found
 	int _TextureCount = 1; //The number of textures associate with the asset
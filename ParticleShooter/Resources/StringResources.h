@@ -15,6 +15,30 @@ namespace Resources
 {
 	namespace Strings
 	{
-		const char* WINDOW_NAME = "Particle Shooter";
+		const char* const WINDOW_NAME = "Particle Shooter";
+		const char* const ASSET_DIRECTORY = "Assets";
+		const char* const ASSET_BUNDLE = "Assets.bundle"; //Pre-decoded graphics. Written by launching with BUNDLE_ASSETS_FLAG
+		/* Launch Flags */
+		const char* const BUNDLE_ASSETS_FLAG = "--bundle-assets";
+		const char* const SOFTWARE_RENDERER_FLAG = "--software-renderer"; //Draws to an offscreen surface with SDL's software renderer
+		const char* const HEADLESS_FLAG = "--headless"; //No window and no drawing. Textures only keep their metadata
+		const char* const UNCAPPED_FLAG = "--uncapped"; //Simulates one tick per loop as fast as possible instead of pacing to real time
+		const char* const TICK_LIMIT_FLAG = "--ticks"; //Followed by the number of ticks to simulate before quitting
+		const char* const PROFILE_FLAG = "--profile"; //Records profiler zones from launch and writes PROFILE_TRACE on quit
+		const char* const PROFILE_OVERLAY_FLAG = "--profile-overlay"; //Starts with the profiler overlay shown
+		const char* const BENCHMARK_FLAG = "--benchmark"; //Followed by a report path. Plays the level headless with scripted input and writes timings there
+		const char* const DETERMINISTIC_FLAG = "--deterministic"; //Times gameplay with the SimulationClock and seeds the world with a fixed seed
+		const char* const SEED_FLAG = "--seed"; //Followed by the world seed. Implies DETERMINISTIC_FLAG
+		const char* const RECORD_FLAG = "--record"; //Followed by a path that every tick's input is recorded to. Implies DETERMINISTIC_FLAG
+		const char* const REPLAY_FLAG = "--replay"; //Followed by a recording to play back instead of live input. Uses the recording's seed
+		const char* const STRESS_FLAG = "--stress"; //Followed by how many of each enemy type to spawn. Plays a generated StressScenario instead of Level 01
+		const char* const STRESS_PICKUPS_FLAG = "--stress-pickups"; //Followed by how many pickups the StressScenario spawns
+		const char* const STRESS_GRID_FLAG = "--stress-grid"; //Lays the StressScenario out in a grid instead of scattering it
+		const char* const STATS_FLAG = "--stats"; //Followed by a .csv or .jsonl path that per frame engine counters are streamed to
+		const char* const ALLOCATION_REPORT_FLAG = "--alloc-report"; //Followed by a path. Tracks heap allocations per frame and zone and writes a JSON report there on quit
+		const char* const ALLOCATION_THRESHOLD_FLAG = "--alloc-threshold"; //Followed by how many allocations a steady state frame may make before it is flagged. Defaults to 0
+
+		/* Profiling */
+		const char* const PROFILE_TRACE = "profile_trace.json";
 	}
 }
\ No newline at end of file
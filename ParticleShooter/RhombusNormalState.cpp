@@ -1,10 +1,18 @@
 #include "EnemyBasicShot.h"
 #include "PlayerInfo.h"
+#include "Random.h"
 #include "RhombusNormalState.h"
 #include "Transform.h"
 
 #include <algorithm>
 
+const int RhombusNormalState::PLAYER_OFFSET_MAGNITUDE;
+const int RhombusNormalState::SPEED_OFFSET_MAGNITUDE;
+const int RhombusNormalState::ATTACK_TIME_OFFSET_MAGNITUDE;
+const int RhombusNormalState::ACCELERATION_MAGNITUDE;
+const int RhombusNormalState::DAMAGED_IMPULSE_MAGNITUDE;
+const int RhombusNormalState::DISTANCE_FROM_PLAYER_TO_MAINTAIN;
+
 RhombusNormalState::RhombusNormalState()
 {
 	const auto basicAttack = std::make_shared<EnemyBasicShot>();
@@ -45,7 +53,7 @@ void RhombusNormalState::OnStart(ObserverController& observerController, Transfo
 /*
 	Description:
 		Relies on base implementation to apply damage. To better convey that a Rhombus
-		it hurt, applies an impulse velocity in the Nudge Direction with a magnitude of _damagedImpulseMagnitude
+		it hurt, applies an impulse velocity in the Nudge Direction with a magnitude of DAMAGED_IMPULSE_MAGNITUDE
 
 	Arguments:
 		pendingDamage - Used to determine if the impulse velocity should be applied
@@ -60,7 +68,7 @@ void RhombusNormalState::ApplyPendingDamage(const int& pendingDamage, TransformP
 	if (pendingDamage > 0)
 	{
 		const auto info = transform->_Collider.GetCollisionResponseInfo();
-		transform->_RigidBody.AddImpulseVelocity(info._NudgeDirection * _damagedImpulseMagnitude);
+		transform->_RigidBody.AddImpulseVelocity(info._NudgeDirection * DAMAGED_IMPULSE_MAGNITUDE);
 	}
 }
 
@@ -107,11 +115,11 @@ void RhombusNormalState::PerformMovementBehavior(ObserverController& observerCon
 	transform->SetForwardVector(playerVector.Normal());
 
 	const float distanceFromPlayer = playerVector.Magnitude();
-	if (distanceFromPlayer > _distanceFromPlayerToMaintain) //Check to see if the enemy is close enough to the player
+	if (distanceFromPlayer > DISTANCE_FROM_PLAYER_TO_MAINTAIN) //Check to see if the enemy is close enough to the player
 	{
 		const Vector2 playerOffsetPosition = playerInfo._CurrentPosition + _playerOffset; //Calculate an offset position from the player to move towards. This keeps all of the enemies from heading to the exact same point
 		const Vector2 acclerationDirection = playerOffsetPosition - transform->GetOrigin();
-		transform->_RigidBody.SetAcceleration(acclerationDirection.Normal() * (_accelerationMagnitude)); //Accelerate in that direction
+		transform->_RigidBody.SetAcceleration(acclerationDirection.Normal() * (ACCELERATION_MAGNITUDE)); //Accelerate in that direction
 	}
 	else //If it is, halt movement entirely
 	{
@@ -136,19 +144,19 @@ void RhombusNormalState::PerformMovementBehavior(ObserverController& observerCon
 */
 void RhombusNormalState::RandomizeMovementTarget(TransformPt& transform)
 {
-	_playerOffset = CommonHelpers::RandomOffset(_playerOffsetMagnitude);
-	const Vector2 speedOffset = CommonHelpers::RandomOffset(_speedOffsetMagnitude);
+	_playerOffset = CommonHelpers::RandomOffset(PLAYER_OFFSET_MAGNITUDE);
+	const Vector2 speedOffset = CommonHelpers::RandomOffset(SPEED_OFFSET_MAGNITUDE);
 	transform->_RigidBody.SetSpeed(_minimumSpeed + speedOffset.x);
 }
 
 /*
 	Description:
-		Randomly selects a MS amount according to _attackTimeOffsetMagnitude. Sets this amount
+		Randomly selects a MS amount according to ATTACK_TIME_OFFSET_MAGNITUDE. Sets this amount
 		as the next attack time. Restarts the timer.
 */
 void RhombusNormalState::ResetAttackTimer()
 {
-	const int randomMillisecond = (rand() % _attackTimeOffsetMagnitude);
+	const int randomMillisecond = Random::GetWorldInstance().Range(ATTACK_TIME_OFFSET_MAGNITUDE);
 	const float randomSeconds = randomMillisecond / 1000.0;
 	_attackTime = std::fmax(randomSeconds, 1.0);
 	_attackTimer.Start();
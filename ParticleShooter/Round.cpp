@@ -2,6 +2,7 @@
 #include "GameObjectObserver.h"
 #include "GameObjectRegistryLocator.h"
 #include "GameObjectRegistryService.h"
+#include "ItemSpawner.h"
 #include "Round.h"
 
 /*
@@ -32,20 +33,12 @@ bool Round::IsRoundComplete() const
 		observer - Observers that want to know that the round has started
 		enemyManager - Responsible for actually creating the enemies that need to be spawned
 */
-
-void Round::StartRound(GameObjectObserver& observer, const EnemyManager& enemyManager)
+void Round::StartRound(GameObjectObserver& observer, EnemyManager& enemyManager)
 {
 	_roundStarted = true;
 	for (const auto& spawn : _enemiesToSpawn)
 	{
-		std::shared_ptr<Enemy> enemy = nullptr;
-		if (spawn.first == 0)
-			enemy = enemyManager.SpawnEnemy(ObjectId::ENEMY_RHOMBUS, spawn.second);
-		else if (spawn.first == 1)
-			enemy = enemyManager.SpawnEnemy(ObjectId::ENEMY_SQUARE, spawn.second);
-		else if (spawn.first == 2)
-			enemy = enemyManager.SpawnEnemy(ObjectId::ENEMY_HEXAGON, spawn.second);
-
+		const std::shared_ptr<Enemy> enemy = enemyManager.SpawnEnemy(spawn.first, spawn.second);
 		if (enemy != nullptr)
 		{
 			GameObjectRegistryService* registry = GameObjectRegistryLocator::GetCreatorService();
@@ -55,10 +48,43 @@ void Round::StartRound(GameObjectObserver& observer, const EnemyManager& enemyMa
 		}
 	}
 
+	for (const auto& spawn : _itemsToSpawn)
+		ItemSpawner::GetInstance().SpawnItem(spawn.first, spawn.second);
+
 	observer.Notify(GameObjectEvent::ROUND_START);
 }
 
+//Lets the EnemyManager prepare copies of the Enemies this Round spawns ahead of StartRound
+void Round::ReserveEnemies(EnemyManager& enemyManager) const
+{
+	for (const auto& spawn : _enemiesToSpawn)
+		enemyManager.Reserve(spawn.first, 1);
+}
+
+/*
+	Description:
+		Queues an Enemy using the EnemyType numbering from the Tiled level layouts. Unknown types are ignored.
+
+	Arguments:
+		enemyType - 0 is a Rhombus, 1 a Square and 2 a Hexagon
+		position - Where the Enemy spawns in world coordinates
+*/
 void Round::AddEnemyToSpawn(const int& enemyType, const Vector2& position)
 {
-	_enemiesToSpawn.emplace_back(std::make_pair(enemyType, position));
+	if (enemyType == 0)
+		AddEnemyToSpawn(ObjectId::ENEMY_RHOMBUS, position);
+	else if (enemyType == 1)
+		AddEnemyToSpawn(ObjectId::ENEMY_SQUARE, position);
+	else if (enemyType == 2)
+		AddEnemyToSpawn(ObjectId::ENEMY_HEXAGON, position);
+}
+
+void Round::AddEnemyToSpawn(const ObjectId& enemyId, const Vector2& position)
+{
+	_enemiesToSpawn.emplace_back(std::make_pair(enemyId, position));
+}
+
+void Round::AddItemToSpawn(const ObjectId& itemId, const Vector2& position)
+{
+	_itemsToSpawn.emplace_back(std::make_pair(itemId, position));
 }
\ No newline at end of file
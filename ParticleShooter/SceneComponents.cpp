@@ -0,0 +1,86 @@
+#include "AnimatedSingleTextureGraphicsController.h"
+#include "GameObject.h"
+#include "SceneComponents.h"
+#include "TimedDestructionController.h"
+#include "Transform.h"
+
+/*
+	Description:
+		Stores the requested components of an object joining the scene.
+
+	Arguments:
+		owner - The object the components belong to
+		components - ComponentType flags for the components to store
+		transform - Moved by the motion loop
+		graphics - Advanced by the animation loop
+		lifetime - Counted down by the lifetime loop. Checked by the other loops even when not attached
+
+	Return:
+		Handles - Hand these back to Detach when the object leaves the scene
+*/
+SceneComponents::Handles SceneComponents::Attach(GameObject& owner, const int& components, Transform& transform, AnimatedSingleTextureGraphicsController& graphics, TimedDestructionController& lifetime)
+{
+	Handles handles;
+	if (components & LIFETIME)
+		handles._Lifetime = _lifetime.Insert({ &owner, &lifetime });
+	if (components & ANIMATION)
+		handles._Animation = _animation.Insert({ &owner, &lifetime, &graphics });
+	if (components & MOTION)
+		handles._Motion = _motion.Insert({ &owner, &lifetime, &transform });
+
+	return handles;
+}
+
+void SceneComponents::Detach(const Handles& handles)
+{
+	_lifetime.Erase(handles._Lifetime);
+	_animation.Erase(handles._Animation);
+	_motion.Erase(handles._Motion);
+}
+
+void SceneComponents::Clear()
+{
+	_lifetime.Clear();
+	_animation.Clear();
+	_motion.Clear();
+}
+
+/*
+	Description:
+		Runs each component loop once. Meant to be called after the scene's GameObjects have responded to
+		this tick's collisions, matching the order that Projectile and Item used to update themselves in.
+*/
+void SceneComponents::Update()
+{
+	for (const LifetimeComponent& lifetime : _lifetime)
+	{
+		if (lifetime._Owner->GetActive())
+			lifetime._Controller->TimeIsUp();
+	}
+
+	for (const AnimationComponent& animation : _animation)
+	{
+		if (IsUpdating(*animation._Owner, *animation._Lifetime))
+			animation._Graphics->Update();
+	}
+
+	for (const MotionComponent& motion : _motion)
+	{
+		if (!IsUpdating(*motion._Owner, *motion._Lifetime))
+			continue;
+
+		motion._Transform->ResolveCollisions();
+		const Vector2 displacement = motion._Transform->_RigidBody.ApplyMovementForces();
+		motion._Transform->Move(displacement);
+	}
+}
+
+/*
+	Description:
+		Whether an object's animation and motion should advance this tick. Lifetimes that ran out earlier in
+		the tick, either in the lifetime loop or in the object's own Update, count as well.
+*/
+bool SceneComponents::IsUpdating(const GameObject& owner, const TimedDestructionController& lifetime)
+{
+	return owner.GetActive() && !lifetime.GetDestroyed();
+}
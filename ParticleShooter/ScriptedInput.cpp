@@ -0,0 +1,31 @@
+#include "Common.h"
+#include "ScriptedInput.h"
+
+#include <cmath>
+
+/*
+	Description:
+		Builds the scripted input for a single simulation tick.
+
+	Arguments:
+		tick - Number of ticks simulated before this one
+
+	Return:
+		InputState - What the player would be pressing on that tick. The cursor is in screen coordinates like PCInputController's
+*/
+InputState ScriptedInput::GetInputState(const int tick) const
+{
+	InputState inputState;
+
+	const Vector2 strafeDirections[] = { Vector2(1, 0), Vector2(0, 1), Vector2(-1, 0), Vector2(0, -1) };
+	inputState._MovementDirection = strafeDirections[(tick / TICKS_PER_STRAFE) % 4];
+
+	const double cursorAngle = 2.0 * 3.14159265358979 * (tick % TICKS_PER_CURSOR_ORBIT) / TICKS_PER_CURSOR_ORBIT;
+	const float cursorRadius = SCREEN_HEIGHT / 3.0f;
+	inputState._CursorPosition = Vector2(static_cast<float>(SCREEN_WIDTH / 2 + cursorRadius * std::cos(cursorAngle)), static_cast<float>(SCREEN_HEIGHT / 2 + cursorRadius * std::sin(cursorAngle)));
+
+	inputState._ShootPressed = true;
+	inputState._BeamPressed = tick % TICKS_BETWEEN_BEAMS < BEAM_TICKS;
+
+	return inputState;
+}
@@ -20,6 +20,11 @@ Vector2 ScrollingCamera::GetPosition() const
 	return _bounds._Origin;
 }
 
+Vector2 ScrollingCamera::GetInterpolatedPosition(const float& alpha) const
+{
+	return _cameraPreviousPosition + ((_bounds._Origin - _cameraPreviousPosition) * alpha);
+}
+
 void ScrollingCamera::ResetPlayerPosition(const Vector2& playerPosition)
 {
 	_playerPreviousPosition = playerPosition;
@@ -41,6 +46,7 @@ void ScrollingCamera::SetCameraPosition(const Vector2& position)
 {
 	_bounds._Origin.x = position.x;
 	_bounds._Origin.y = position.y;
+	_cameraPreviousPosition = _bounds._Origin; //Jumping the camera shouldn't be interpolated
 }
 
 /*
@@ -1,5 +1,7 @@
 #include "Collider.h"
+#include "FrameArena.h"
 #include "SeparatingAxisCollision.h"
+#include "Stats.h"
 
 using std::vector;
 
@@ -116,7 +118,9 @@ Vector2 SeparatingAxisCollision::CalculateCollisionPoint(const ColliderInterface
 	if (polygonA->IsCircular() && polygonB->IsCircular())
 		return CalculateCircleCollisionPoint(polygonA, polygonB);
 
-	vector<Vector2> collidingVertices;
+	FrameArena::Scope scope; //Runs once per colliding pair, so the vertices are released straight away
+	std::pmr::vector<Vector2> collidingVertices(&FrameArena::GetInstance());
+	collidingVertices.reserve(polygonA->GetVertices()->size() + polygonB->GetVertices()->size());
 	CalculateCollidingVertices(polygonA, polygonB, collidingVertices);
 	CalculateCollidingVertices(polygonB, polygonA, collidingVertices);
 
@@ -146,6 +150,8 @@ Vector2 SeparatingAxisCollision::CalculateCollisionPoint(const ColliderInterface
 */
 Extents SeparatingAxisCollision::CalculateMinMixProjection(const Vector2& projectionVector, const ColliderInterface* polygon)
 {
+	Stats::GetInstance().Increment(StatCounter::AXIS_PROJECTIONS);
+
 	Extents projectionMinMax;
 	bool minSet = false, maxSet = false;
 
@@ -176,6 +182,8 @@ Extents SeparatingAxisCollision::CalculateMinMixProjection(const Vector2& projec
 
 Extents SeparatingAxisCollision::CalculateMinMixProjection(const Vector2& projectionVector, const Vector2& point)
 {
+	Stats::GetInstance().Increment(StatCounter::AXIS_PROJECTIONS);
+
 	Extents projectionMinMax;
 	bool minSet = false, maxSet = false;
 
@@ -195,7 +203,7 @@ Extents SeparatingAxisCollision::CalculateMinMixProjection(const Vector2& projec
 		polygonB - The collider that is being tested against
 		collidingVerticesA - A reference vector which is updated which the polygonA vertices that are colliding with polygonB
 */
-void SeparatingAxisCollision::CalculateCollidingVertices(const ColliderInterface* polygonA, const ColliderInterface* polygonB, vector<Vector2>& collidingVerticesA)
+void SeparatingAxisCollision::CalculateCollidingVertices(const ColliderInterface* polygonA, const ColliderInterface* polygonB, std::pmr::vector<Vector2>& collidingVerticesA)
 {
 	auto vertices = polygonA->GetVertices();
 	for (int i = 0; i < vertices->size(); i++)
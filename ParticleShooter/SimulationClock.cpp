@@ -0,0 +1,3 @@
+#include "SimulationClock.h"
+
+Uint64 SimulationClock::TICKS = 0;
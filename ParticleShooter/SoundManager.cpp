@@ -1,6 +1,7 @@
 #include "ErrorHandler.h"
 #include "SoundManager.h"
 #include "SoundAssetResources.h"
+#include "Stats.h"
 
 #include <SDL_mixer.h>
 
@@ -27,6 +28,7 @@ SoundManager::~SoundManager()
 
 void SoundManager::PlaySound(const std::shared_ptr<const Sound>& sound) const
 {
+	Stats::GetInstance().Increment(StatCounter::SOUNDS_TRIGGERED);
 	SetChannelVolume(sound->_ChannelType, sound->_Volume);
 
 	if (sound->_ChannelType == SoundChannel::BACKGROUND_MUSIC)
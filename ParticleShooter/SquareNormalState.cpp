@@ -5,6 +5,13 @@
 #include "SquareNormalState.h"
 #include "Transform.h"
 
+const float SquareNormalState::ACCELERATION_MAGNITUDE = 8000;
+const Vector2 SquareNormalState::UP = Vector2(0, -1);
+const Vector2 SquareNormalState::DOWN = Vector2(0, 1);
+const Vector2 SquareNormalState::RIGHT = Vector2(1, 0);
+const Vector2 SquareNormalState::LEFT = Vector2(-1, 0);
+const int SquareNormalState::TARGET_SEEKING_HALF_ANGLE;
+
 SquareNormalState::SquareNormalState()
 {
 	_attackWarningBeamPrototype = std::make_shared<GraphicObject>(Resources::Graphics::WARNING_BEAM_EFFECT, 0.5);
@@ -95,14 +102,14 @@ void SquareNormalState::SearchForTargets(const PlayerInfo& playerInfo, const Tra
 		farDirection -  The opposite direction
 
 	Return:
-		bool - Whether or not the Target was within the _targetSeekingHalfAngle in either the close or far direction
+		bool - Whether or not the Target was within the TARGET_SEEKING_HALF_ANGLE in either the close or far direction
 
 */
 bool SquareNormalState::CheckIfTargetIsInRange(const float& targetAngle, const Vector2& closeDirection, const Vector2 farDirection)
 {
-	if (targetAngle <= _targetSeekingHalfAngle || targetAngle >= 180 - _targetSeekingHalfAngle)
+	if (targetAngle <= TARGET_SEEKING_HALF_ANGLE || targetAngle >= 180 - TARGET_SEEKING_HALF_ANGLE)
 	{
-		if (targetAngle <= _targetSeekingHalfAngle)
+		if (targetAngle <= TARGET_SEEKING_HALF_ANGLE)
 			_attackDirection = closeDirection;
 		else
 			_attackDirection = farDirection;
@@ -168,7 +175,7 @@ void SquareNormalState::PerformMovementBehavior(ObserverController& observerCont
 		SearchForTargets(playerInfo, transform, observerController);
 
 	if (_attacking)
-		transform->_RigidBody.SetAcceleration(_attackDirection * _accelerationMagnitude); //Square maintains the same acceleration magnitude while attacking
+		transform->_RigidBody.SetAcceleration(_attackDirection * ACCELERATION_MAGNITUDE); //Square maintains the same acceleration magnitude while attacking
 	else
 		transform->_RigidBody.SetAcceleration(Vector2(0, 0));
 
@@ -0,0 +1,131 @@
+#include "Stats.h"
+
+std::atomic<int> Stats::HEAP_ALLOCATIONS{ 0 };
+
+/*
+	Description:
+		Finishes the frame being counted. The counts are kept for GetLastFrame, streamed to the log if one is open
+		and then reset. Gauges and the live GameObject counts are sampled rather than summed, so they carry over into the next frame.
+*/
+void Stats::EndFrame()
+{
+	Set(StatCounter::HEAP_ALLOCATIONS, HEAP_ALLOCATIONS.exchange(0, std::memory_order_relaxed));
+
+	_lastFrameCounters = _counters;
+	_lastFrameLiveGameObjects = _liveGameObjects;
+	_frameCount++;
+
+	if (_log.is_open())
+		WriteRow();
+
+	for (int counter = 0; counter < static_cast<int>(StatCounter::COUNT); counter++)
+	{
+		if (!IsGauge(counter))
+			_counters[counter] = 0;
+	}
+}
+
+/*
+	Description:
+		Starts streaming one row per finished frame. Paths ending in .jsonl are written as JSON Lines, anything
+		else as CSV with a header row.
+
+	Arguments:
+		filePath - Where to write the log. Overwritten if it already exists
+
+	Return:
+		bool - Whether or not the log could be opened
+*/
+bool Stats::OpenLog(const std::string& filePath)
+{
+	CloseLog();
+
+	const std::string jsonLinesExtension = ".jsonl";
+	const bool jsonLines = filePath.size() >= jsonLinesExtension.size() &&
+		filePath.compare(filePath.size() - jsonLinesExtension.size(), jsonLinesExtension.size(), jsonLinesExtension) == 0;
+	_logFormat = jsonLines ? LogFormat::JSON_LINES : LogFormat::CSV;
+
+	_log.open(filePath, std::ios::trunc);
+	if (!_log.is_open())
+		return false;
+
+	if (_logFormat == LogFormat::CSV)
+		WriteHeader();
+
+	return true;
+}
+
+void Stats::CloseLog()
+{
+	if (_log.is_open())
+		_log.close();
+}
+
+void Stats::WriteHeader()
+{
+	_log << "frame";
+	for (int layer = 0; layer < RENDERING_LAYER_COUNT; layer++)
+		_log << ",objects_" << GetLayerName(layer);
+	for (int counter = 0; counter < static_cast<int>(StatCounter::COUNT); counter++)
+		_log << "," << GetCounterName(counter);
+	_log << "\n";
+}
+
+void Stats::WriteRow()
+{
+	if (_logFormat == LogFormat::CSV)
+	{
+		_log << _frameCount;
+		for (const int count : _lastFrameLiveGameObjects)
+			_log << "," << count;
+		for (const int count : _lastFrameCounters)
+			_log << "," << count;
+	}
+	else
+	{
+		_log << "{\"frame\":" << _frameCount;
+		for (int layer = 0; layer < RENDERING_LAYER_COUNT; layer++)
+			_log << ",\"objects_" << GetLayerName(layer) << "\":" << _lastFrameLiveGameObjects[layer];
+		for (int counter = 0; counter < static_cast<int>(StatCounter::COUNT); counter++)
+			_log << ",\"" << GetCounterName(counter) << "\":" << _lastFrameCounters[counter];
+		_log << "}";
+	}
+
+	_log << "\n";
+}
+
+//Gauges hold their value until they are Set again. Everything else is summed per frame
+bool Stats::IsGauge(const int counter)
+{
+	switch (static_cast<StatCounter>(counter))
+	{
+	case StatCounter::COLLIDERS:
+	case StatCounter::QUALITY_LEVEL:
+	case StatCounter::PROJECTILE_POOL_SIZE:
+	case StatCounter::PROJECTILE_POOL_HIGH_WATER:
+		return true;
+	default:
+		return false;
+	}
+}
+
+//Column names, in StatCounter order
+const char* Stats::GetCounterName(const int counter)
+{
+	static const char* const NAMES[] = { "colliders", "broadphase_pairs", "axis_projections", "collisions", "draw_calls",
+		"texture_binds", "particles_spawned", "sounds_triggered", "heap_allocations", "ticks_simulated", "ticks_dropped",
+		"budget_overruns", "quality_level", "projectiles_created", "projectiles_recycled", "projectile_pool_size",
+		"projectile_pool_high_water" };
+	static_assert(sizeof(NAMES) / sizeof(NAMES[0]) == static_cast<int>(StatCounter::COUNT), "Every StatCounter needs a column name");
+
+	return NAMES[counter];
+}
+
+//Column names, in RenderingLayer order
+const char* Stats::GetLayerName(const int layer)
+{
+	static const char* const NAMES[] = { "ui", "particles", "player", "enemies", "items", "general", "level" };
+	static_assert(sizeof(NAMES) / sizeof(NAMES[0]) == RENDERING_LAYER_COUNT, "Every RenderingLayer needs a column name");
+
+	return NAMES[layer];
+}
@@ -0,0 +1,91 @@
+#include "ParticleShooterLevel.h"
+#include "Random.h"
+#include "StressScenario.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/*
+	Description:
+		The usual scaling test setup. The same number of every Enemy type in a single Wave.
+
+	Arguments:
+		enemiesPerType - Spawned for each of the Rhombus, Square and Hexagon
+		pickups - Items spawned alongside the Enemies
+
+	Return:
+		StressScenario - Randomly placed with the default seed
+*/
+StressScenario StressScenario::Uniform(const int enemiesPerType, const int pickups)
+{
+	StressScenario scenario;
+	scenario._EnemyCounts[ObjectId::ENEMY_RHOMBUS] = enemiesPerType;
+	scenario._EnemyCounts[ObjectId::ENEMY_SQUARE] = enemiesPerType;
+	scenario._EnemyCounts[ObjectId::ENEMY_HEXAGON] = enemiesPerType;
+	scenario._Pickups = pickups;
+
+	return scenario;
+}
+
+/*
+	Description:
+		Builds the scenario's Waves in the given level. Every Wave gets one Round holding all of its Enemies and pickups.
+		Enemy types are interleaved so that grid placement doesn't group them into bands.
+
+	Arguments:
+		level - Receives the Waves. Expected to have none of its own
+		spawnArea - World coordinates that spawns are placed within
+*/
+void StressScenario::Populate(ParticleShooterLevel& level, const Rectangle& spawnArea) const
+{
+	const int enemiesPerWave = GetEnemiesPerWave();
+	std::vector<ObjectId> enemies;
+	enemies.reserve(enemiesPerWave);
+
+	std::map<ObjectId, int> remaining = _EnemyCounts;
+	while (static_cast<int>(enemies.size()) < enemiesPerWave)
+	{
+		for (auto& count : remaining)
+		{
+			if (count.second > 0)
+			{
+				enemies.push_back(count.first);
+				count.second--;
+			}
+		}
+	}
+
+	const int spawnCount = static_cast<int>(enemies.size()) + _Pickups;
+	const int columns = std::max(1, static_cast<int>(std::ceil(std::sqrt(spawnCount * spawnArea._Width / std::max(spawnArea._Height, 1.0f)))));
+	const int rows = std::max(1, (spawnCount + columns - 1) / columns);
+
+	Random random(_Seed);
+	for (int waveNumber = 0; waveNumber < _Waves; waveNumber++)
+	{
+		Round* round = level.GetWave(waveNumber)->GetRound(0);
+
+		for (int spawn = 0; spawn < spawnCount; spawn++)
+		{
+			Vector2 position;
+			if (_Placement == Placement::GRID)
+				position = Vector2(spawnArea._Origin.x + (spawn % columns + 0.5f) * spawnArea._Width / columns, spawnArea._Origin.y + (spawn / columns + 0.5f) * spawnArea._Height / rows);
+			else
+				position = Vector2(spawnArea._Origin.x + random.Range(static_cast<int>(spawnArea._Width)), spawnArea._Origin.y + random.Range(static_cast<int>(spawnArea._Height)));
+
+			if (spawn < static_cast<int>(enemies.size()))
+				round->AddEnemyToSpawn(enemies.at(spawn), position);
+			else
+				round->AddItemToSpawn(spawn % 2 == 0 ? ObjectId::PICK_UP_HEALTH : ObjectId::PICK_UP_BOUNCE, position);
+		}
+	}
+}
+
+int StressScenario::GetEnemiesPerWave() const
+{
+	int enemies = 0;
+	for (const auto& count : _EnemyCounts)
+		enemies += std::max(count.second, 0);
+
+	return enemies;
+}
@@ -1,20 +1,47 @@
+#include "AssetBundle.h"
 #include "GraphicAssetInfo.h"
+#include "Profiler.h"
 #include "Renderer.h"
 #include "Texture.h"
 
 
 Texture::Texture(const std::string& filePath, const float& scaleFactor)
 {
-    //The Renderer acts as a wrapper for the SDL_Renderer which is needed of making SDL_Textures
-    Renderer::CreateTextureFromFile(*this, filePath);
+    ProfileZone zone("Load/Texture");
+
+    //The Renderer acts as a wrapper for the SDL_Renderer which is needed of making SDL_Textures.
+    //Pre-decoded pixels from the AssetBundle are used when available, otherwise the png is loaded from disk
+    const AssetBundle& bundle = AssetBundle::GetInstance();
+    const AssetBundle::Image* bundledImage = bundle.FindImage(filePath);
+
+    if (bundledImage != nullptr)
+        Renderer::CreateTextureFromPixels(*this, bundle.GetPixels(*bundledImage), bundledImage->_Width, bundledImage->_Height, bundledImage->_Pitch, bundle.GetPixelFormat());
+    else
+        Renderer::CreateTextureFromFile(*this, filePath);
     _scale = scaleFactor;
 }
 
+/*
+    Description:
+        Creates a Texture from pixels generated at runtime (for instance, composited background tiles)
+
+    Arguments:
+        pixels - The first pixel of the image. Only read during construction
+        width - Width of the image in pixels
+        height - Height of the image in pixels
+        pitch - Number of bytes in a single row of pixels
+        pixelFormat - The SDL_PixelFormatEnum that pixels are stored in
+*/
+Texture::Texture(const void* pixels, const int& width, const int& height, const int& pitch, const Uint32& pixelFormat)
+{
+    Renderer::CreateTextureFromPixels(*this, pixels, width, height, pitch, pixelFormat);
+}
+
 Texture::~Texture()
 {
     if (_sdlTexture != nullptr)
     {
-        SDL_DestroyTexture(_sdlTexture);
+        Renderer::DestroyTexture(_sdlTexture);
         _sdlTexture = nullptr;
     }
 }
@@ -24,6 +51,7 @@ Texture::~Texture()
         A static function used to create an list of Textures all at once (typically all of the textures within an Animation.
         Requires that textures are .png files.
         Requires that textures files utilize the same naming convention ("fileName_01" , "fileName_02", ...)
+        Textures are read from the AssetBundle if one is open and contains the file. Otherwise, the loose png is decoded.
 
     Arguments:
 		textures - Pass by Ref vector of textures. Will be populated with textures defined in textureInfo.
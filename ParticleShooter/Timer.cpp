@@ -1,10 +1,13 @@
 
+#include "SimulationClock.h"
 #include "Timer.h"
 
+TimeSource Timer::DEFAULT_SOURCE = TimeSource::WALL_CLOCK;
+
 void Timer::Start()
 {
     _active = true;
-    _millisecondsSinceStarting = SDL_GetTicks(); //Gets the # of MS passed since game start
+    _millisecondsSinceStarting = GetCurrentMilliseconds(_source); //Gets the # of MS passed since game start
 }
 
 void Timer::Stop()
@@ -15,7 +18,7 @@ void Timer::Stop()
 Uint32 Timer::GetMilliseconds() const
 {
     if (_active)
-        return SDL_GetTicks() - _millisecondsSinceStarting; //Total MS since game start minus the MS that has passed at the time that the timer was started
+        return GetCurrentMilliseconds(_source) - _millisecondsSinceStarting; //Total MS since game start minus the MS that has passed at the time that the timer was started
 
     return 0;
 }
@@ -24,3 +27,21 @@ float Timer::GetSeconds() const
 {
     return GetMilliseconds() / 1000.0; //1000 MS in a Second
 }
+
+/*
+    Description:
+        Reads the current time of a clock.
+
+    Arguments:
+        source - Which clock to read
+
+    Return:
+        Uint32 - Milliseconds since the clock started
+*/
+Uint32 Timer::GetCurrentMilliseconds(const TimeSource& source)
+{
+    if (source == TimeSource::SIMULATION)
+        return SimulationClock::GetMilliseconds();
+
+    return SDL_GetTicks();
+}
@@ -2,6 +2,8 @@
 #include "ErrorHandler.h"
 #include "Transform.h"
 
+#include <cmath>
+
 Transform::Transform() : _aabb(Rectangle(0,0,1,1))
 {
 }
@@ -131,6 +133,62 @@ void Transform::SetPosition(const Vector2& position)
 	_Collider.SetPosition(position);
 }
 
+/*
+	Description:
+		Remembers the current pose as the pose the next simulation tick started from.
+		Must be called before the tick moves or rotates the Transform.
+*/
+void Transform::StorePreviousPose()
+{
+	_previousOrigin = _aabb._Origin;
+	_previousOrientation = _orientation;
+	_hasPreviousPose = true;
+}
+
+/*
+	Description:
+		Blends between the pose at the start of the last simulation tick and the current pose.
+		Lets rendering run at a different rate than the fixed simulation step without judder.
+
+	Arguments:
+		alpha - How far rendering is between the previous tick (0) and the current tick (1)
+
+	Return:
+		Vector2 - The interpolated world space origin
+*/
+Vector2 Transform::GetInterpolatedOrigin(const float& alpha) const
+{
+	if (!_hasPreviousPose)
+		return _aabb._Origin;
+
+	return _previousOrigin + ((_aabb._Origin - _previousOrigin) * alpha);
+}
+
+/*
+	Description:
+		Blends between the orientation at the start of the last simulation tick and the current orientation.
+		Always turns the short way around so that crossing 180 degrees doesn't spin the texture.
+
+	Arguments:
+		alpha - How far rendering is between the previous tick (0) and the current tick (1)
+
+	Return:
+		double - The interpolated orientation angle. Clockwise is positive
+*/
+double Transform::GetInterpolatedOrientationAngle(const float& alpha) const
+{
+	if (!_hasPreviousPose)
+		return _orientation;
+
+	double orientationChange = fmod(_orientation - _previousOrientation, 360.0);
+	if (orientationChange > 180.0)
+		orientationChange -= 360.0;
+	else if (orientationChange < -180.0)
+		orientationChange += 360.0;
+
+	return _previousOrientation + (orientationChange * alpha);
+}
+
 /*
 	Description:
 		Updates the RigidBody according to the results of the current Collision
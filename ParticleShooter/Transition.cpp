@@ -28,35 +28,4 @@ void Transition::AddProperty(const std::pair<Property, int>& transitionProperty)
 void Transition::AddProperty(const std::vector<std::pair<Property, int>>& transitionProperties)
 {
 	_propertyValues.insert(_propertyValues.end(), transitionProperties.cbegin(), transitionProperties.cend());
-}
-
-/*
-	Description:
-		Goes through each property pairing in _propertyValues. Compares those values
-		with the ones stored in the propertyController. If any of the values don't exactly match,
-		returns false. As long as all of the values match, returns true.
-
-	Arguments:
-		propertyController - A list of properties for an object. Used to compare against _propertyValues
-
-	Return:
-		bool - Whether or not the animator should use this transition and go to the destination animation
- */
-bool Transition::ShouldTransition(const PropertyController& propertyController) const
-{
-	bool shouldTransition = true;
-
-	for (int j = 0; j < _propertyValues.size(); j++)
-	{
-		const auto& property = _propertyValues.at(j);
-		const bool transitionPropertyMatched = propertyController.ComparePropertyValue(property.first, property.second);
-
-		if (!transitionPropertyMatched)
-		{
-			shouldTransition = false;
-			break;
-		}
-	}
-
-	return shouldTransition;
 }
\ No newline at end of file
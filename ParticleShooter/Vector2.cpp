@@ -1,6 +1,7 @@
 #include "Common.h"
 #include "Vector2.h"
 
+#include <cmath>
 #include <iostream>
 
 
@@ -1,5 +1,7 @@
 #include "Wave.h"
 
+const int Wave::PREWARM_COPIES_PER_UPDATE;
+
 /*
 	Description:
 		Gets a pointer to the Round object associated with the given number.
@@ -20,23 +22,36 @@ Round* Wave::GetRound(const int& roundNumber)
 	return &_rounds[roundNumber];
 }
 
-void Wave::StartWave()
+/*
+	Description:
+		Starts the delay before the first Round and reserves every Enemy the Wave will spawn, so that
+		they can be copied ahead of time while the delay runs.
+
+	Arguments:
+		enemyManager - Prepares the Enemies this Wave spawns
+*/
+void Wave::StartWave(EnemyManager& enemyManager)
 {
 	_waveStarted = true;
 	_startDelay = true;
 	_waveStartTimer.Start();
+
+	for (const auto& round : _rounds)
+		round.second.ReserveEnemies(enemyManager);
 }
 
 /*
 	Description:
 		Keeps track of the wave delay timer. Once that elapses, the wave officially begins.
+		Reserved Enemies are prewarmed a few at a time until then.
 		After the wave begins, Update keeps track of the progress of each of its Rounds and starts
 		the next Round when the previous one has completed.
 */
-void Wave::Update(GameObjectObserver& observer, const EnemyManager& enemyManager)
+void Wave::Update(GameObjectObserver& observer, EnemyManager& enemyManager)
 {
 	if (_startDelay)
 	{
+		enemyManager.Prewarm(PREWARM_COPIES_PER_UPDATE);
 		if (_waveStartTimer.GetSeconds() >= _waveStartTime)
 		{
 			_rounds[_currentRound].StartRound(observer, enemyManager);
@@ -6,54 +6,207 @@
 //  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
 //
 
+#include "AllocationTracker.h"
+#include "AssetBundle.h"
 #include "Common.h"
+#include "ErrorHandler.h"
+#include "FrameGovernor.h"
+#include "GameBenchmark.h"
 #include "GameManager.h"
 #include "InputManager.h"
+#include "InputRecorder.h"
+#include "LaunchOptions.h"
+#include "ParticleShooterStressLevel.h"
+#include "Profiler.h"
+#include "ReplayInputController.h"
+#include "Stats.h"
+#include "StringResources.h"
 #include "Timer.h"
 
-#include <algorithm>
+#include <iostream>
 #include <memory>
 
 
 int main( int argc, char* args[] )
 {
-    std::unique_ptr<GameManager> mainGame(new GameManager());
-    mainGame->Initialize();
+    const LaunchOptions options = LaunchOptions::Parse(argc, args);
+
+    //Offline step: pre-decode every graphic into the AssetBundle that Textures load from on later launches
+    if (options._BundleAssets)
+        return AssetBundle::Build(Resources::Strings::ASSET_DIRECTORY, Resources::Strings::ASSET_BUNDLE) ? 0 : 1;
+
+    Profiler::GetInstance().SetEnabled(options._Profile || options._ProfileOverlay);
+    if (!options._StatsPath.empty())
+        ErrorHandler::Assert(Stats::GetInstance().OpenLog(options._StatsPath), "Unable to open the stats log: " + options._StatsPath);
+
+    AllocationTracker& allocationTracker = AllocationTracker::GetInstance();
+    allocationTracker.SetEnabled(!options._AllocationReport.empty());
+    allocationTracker.SetFrameThreshold(options._AllocationThreshold);
+
+    //Headless runs have no one listening. SDL's dummy driver keeps the mixer working without an audio device
+    if (options._RenderingBackend == RenderingBackend::NONE)
+        SDL_setenv("SDL_AUDIODRIVER", "dummy", 1);
+
+    //Deterministic runs time gameplay in fixed ticks and always start from the same seed, so identical inputs replay identically
+    if (options._Deterministic)
+        Timer::SetDefaultTimeSource(TimeSource::SIMULATION);
+    Uint32 seed = options._Deterministic ? options._Seed : static_cast<Uint32>(SDL_GetPerformanceCounter());
+
+    //A replay only matches the recorded session when the world starts from the seed it was recorded with
+    std::unique_ptr<ReplayInputController> replay;
+    if (!options._ReplayPath.empty())
+    {
+        replay.reset(new ReplayInputController(options._ReplayPath));
+        if (!replay->IsLoaded())
+            return 1;
+        seed = replay->GetSeed();
+    }
+
+    std::unique_ptr<GameManager> mainGame(new GameManager(options._RenderingBackend, seed));
+
+    //Scaling tests swap Level 01's hand made waves for a generated layout of any size
+    std::shared_ptr<Level> startingLevel = nullptr;
+    if (options._StressEnemies > 0 || options._StressPickups > 0)
+    {
+        StressScenario scenario = StressScenario::Uniform(options._StressEnemies, options._StressPickups);
+        scenario._Placement = options._StressGrid ? StressScenario::Placement::GRID : StressScenario::Placement::RANDOM;
+        startingLevel = std::make_shared<ParticleShooterStressLevel>(scenario);
+    }
+
+    mainGame->Initialize(startingLevel);
+    mainGame->SetProfilerOverlay(options._ProfileOverlay);
+
+    if (!options._BenchmarkReport.empty())
+    {
+        GameBenchmark benchmark(options._TickLimit > 0 ? options._TickLimit : GameBenchmark::DEFAULT_TICK_COUNT);
+        benchmark.Run(*mainGame);
+        bool reportWritten = benchmark.WriteReport(options._BenchmarkReport);
+        if (allocationTracker.IsEnabled())
+            reportWritten = allocationTracker.WriteReport(options._AllocationReport) && reportWritten;
+
+        Stats::GetInstance().CloseLog();
+        mainGame->QuitGame();
+        return reportWritten ? 0 : 1;
+    }
+
+    InputRecorder recorder;
+    if (!options._RecordPath.empty())
+        ErrorHandler::Assert(recorder.Open(options._RecordPath, seed), "Unable to open the input recording: " + options._RecordPath);
 
     const int MS_PER_FRAME = 1000 / DESIRED_UPDATES_PER_SECOND;
 
-    Timer gameTime;
+    Timer gameTime(TimeSource::WALL_CLOCK); //Paces the loop, so it always follows real time
     gameTime.Start();
 
     double previous = gameTime.GetMilliseconds();
     double lag = 0.0;
+    FrameGovernor governor(MS_PER_FRAME);
 
+    int ticksSimulated = 0;
     bool quit = false;
+    InputState input;
+    InputState previousInput;
     InputManager playerInput;
+
+    //A replay holds one tick of input per poll, so it is polled for every tick instead of every frame to keep catch up ticks in step
+    const bool replaying = (replay != nullptr);
+    if (replaying)
+        playerInput.SetInputController(std::move(replay));
+
+    auto simulateTick = [&]()
+    {
+        if (replaying)
+        {
+            input = playerInput.PollPlayerInput();
+            if (input._QuitPressed)
+                return; //The recording ran out or the viewer left. Every recorded tick has been played
+        }
+
+        recorder.Record(input);
+        mainGame->Update(input);
+        ticksSimulated++;
+    };
+
     while (!quit)
     {
+        const int ticksBeforeFrame = ticksSimulated;
         const double current = gameTime.GetMilliseconds();
         const double elapsed = current - previous;
         previous = current;
         lag += elapsed;
 
-        const InputState input = playerInput.PollPlayerInput();
-        quit = input._QuitPressed;
+        if (!replaying)
+            input = playerInput.PollPlayerInput();
 
         /*
-            In the situation that the game is running behind the desired FPS,
-            update the non rendering related game logic until the game catches up
+            Profiler hotkeys. The first trace press starts recording, later presses write out what was recorded.
+            Replays ignore the recorded presses so that playback runs with the profiler settings it was launched with
         */
-        while (lag >= MS_PER_FRAME)
+        if (!replaying)
+        {
+            if (input._ProfileTracePressed && !previousInput._ProfileTracePressed)
+            {
+                if (Profiler::GetInstance().IsEnabled())
+                    Profiler::GetInstance().WriteChromeTrace(Resources::Strings::PROFILE_TRACE);
+                Profiler::GetInstance().SetEnabled(true);
+            }
+            if (input._ProfileOverlayPressed && !previousInput._ProfileOverlayPressed)
+            {
+                Profiler::GetInstance().SetEnabled(true);
+                mainGame->SetProfilerOverlay(!mainGame->GetProfilerOverlay());
+            }
+            previousInput = input;
+        }
+
+        if (options._Uncapped)
+        {
+            //Benchmarking and CI. Simulate exactly one tick per loop as fast as the machine allows
+            simulateTick();
+            lag = 0.0;
+        }
+        else
         {
-            mainGame->Update(input);
-            lag -= MS_PER_FRAME;
+            /*
+                In the situation that the game is running behind the desired FPS,
+                update the non rendering related game logic until the game catches up.
+                The governor bounds how many ticks a single frame may catch up on
+            */
+            const int ticks = governor.BeginFrame(lag);
+            for (int tick = 0; tick < ticks; tick++)
+                simulateTick();
         }
-        lag = std::max(lag, 0.0);
 
-        mainGame->Render();
+        quit = input._QuitPressed;
+
+        /*
+            The leftover lag is how far the real time has moved past the last simulated tick.
+            Render blends between the last two ticks by that amount so motion stays smooth at any display rate.
+            Uncapped runs don't follow real time, so they always draw the tick that was just simulated
+        */
+        const double interpolation = options._Uncapped ? 1.0 : lag / MS_PER_FRAME;
+        mainGame->Render(static_cast<float>(interpolation));
+
+        //Uncapped runs are measuring the game, so they always keep full quality
+        if (!options._Uncapped && governor.EndFrame())
+            mainGame->SetQuality(governor.GetQualitySettings());
+        Stats::GetInstance().EndFrame();
+        allocationTracker.EndFrame(ticksSimulated - ticksBeforeFrame);
+
+        if (options._TickLimit > 0 && ticksSimulated >= options._TickLimit)
+            quit = true;
     }
 
+    if (options._Profile)
+        Profiler::GetInstance().WriteChromeTrace(Resources::Strings::PROFILE_TRACE);
+
+    if (allocationTracker.IsEnabled())
+        ErrorHandler::Assert(allocationTracker.WriteReport(options._AllocationReport), "Unable to write the allocation report: " + options._AllocationReport);
+
+    if (options._Deterministic)
+        std::cout << "Ticks: " << ticksSimulated << " State hash: " << std::hex << mainGame->GetStateHash() << std::endl;
+
+    recorder.Close();
+    Stats::GetInstance().CloseLog();
     mainGame->QuitGame();
     
     return 0;
@@ -0,0 +1,122 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+BenchmarkRunner::BenchmarkRunner(const std::string& filter, const double& minimumBatchSeconds, const int batches) :
+	_filter(filter), _minimumBatchSeconds(minimumBatchSeconds), _batches(std::max(batches, 1))
+{
+}
+
+/*
+	Description:
+		Calibrates, times and records a single benchmark. Skipped if its name doesn't match the filter.
+
+	Arguments:
+		name - Identifies the benchmark in the results. Usually the function being measured
+		parameter - Problem size the kernel was set up with. 0 if there is none
+		kernel - Runs the code being measured the requested number of times
+*/
+void BenchmarkRunner::Run(const std::string& name, const int parameter, const Kernel& kernel)
+{
+	if (!_filter.empty() && name.find(_filter) == std::string::npos)
+		return;
+
+	//Double the iterations until a batch is long enough for the clock's resolution not to matter
+	int iterations = 1;
+	while (TimeBatch(kernel, iterations) < _minimumBatchSeconds && iterations < (1 << 30))
+		iterations *= 2;
+
+	std::vector<double> nanoseconds;
+	for (int batch = 0; batch < _batches; batch++)
+		nanoseconds.push_back(TimeBatch(kernel, iterations) * 1e9 / iterations);
+	std::sort(nanoseconds.begin(), nanoseconds.end());
+
+	Result result;
+	result._Name = name;
+	result._Parameter = parameter;
+	result._Iterations = iterations;
+	result._MedianNanoseconds = nanoseconds.at(nanoseconds.size() / 2);
+	result._FastestNanoseconds = nanoseconds.front();
+	_results.push_back(result);
+
+	std::cerr << name << " [" << parameter << "] " << result._MedianNanoseconds << " ns" << std::endl;
+}
+
+/*
+	Description:
+		Runs the kernel once for the given number of iterations.
+
+	Return:
+		double - How long the batch took in seconds
+*/
+double BenchmarkRunner::TimeBatch(const Kernel& kernel, const int iterations) const
+{
+	const auto start = std::chrono::steady_clock::now();
+	kernel(iterations);
+	const auto end = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double>(end - start).count();
+}
+
+void BenchmarkRunner::WriteJson(std::ostream& output) const
+{
+	output << "{\n  \"benchmarks\": [";
+	for (size_t i = 0; i < _results.size(); i++)
+	{
+		const Result& result = _results.at(i);
+		output << (i == 0 ? "\n" : ",\n")
+			<< "    {\"name\": \"" << result._Name << "\""
+			<< ", \"parameter\": " << result._Parameter
+			<< ", \"iterations\": " << result._Iterations
+			<< ", \"median_ns\": " << result._MedianNanoseconds
+			<< ", \"fastest_ns\": " << result._FastestNanoseconds << "}";
+	}
+	output << "\n  ]\n}\n";
+}
+
+/*
+	Usage:
+		ParticleShooterBenchmarks [--filter <substring>] [--min-time <seconds>] [--out <results.json>]
+
+	Results are printed to stdout as JSON unless --out is given. Progress goes to stderr.
+*/
+int main(int argc, char* args[])
+{
+	std::string filter;
+	std::string outputPath;
+	double minimumBatchSeconds = 0.1;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string flag = args[i];
+
+		if (flag == "--filter" && i + 1 < argc)
+			filter = args[++i];
+		else if (flag == "--min-time" && i + 1 < argc)
+			minimumBatchSeconds = std::atof(args[++i]);
+		else if (flag == "--out" && i + 1 < argc)
+			outputPath = args[++i];
+	}
+
+	BenchmarkRunner runner(filter, minimumBatchSeconds);
+	PhysicsBenchmarks::RunSeparatingAxisCollisionBenchmarks(runner);
+	PhysicsBenchmarks::RunPolygonBenchmarks(runner);
+	PhysicsBenchmarks::RunTransformBenchmarks(runner);
+	PhysicsBenchmarks::RunRigidBodyBenchmarks(runner);
+	PhysicsBenchmarks::RunCollisionResponseBenchmarks(runner);
+	PhysicsBenchmarks::RunCollisionManagerBenchmarks(runner);
+
+	if (outputPath.empty())
+	{
+		runner.WriteJson(std::cout);
+		return 0;
+	}
+
+	std::ofstream output(outputPath, std::ios::trunc);
+	runner.WriteJson(output);
+	return output.good() ? 0 : 1;
+}
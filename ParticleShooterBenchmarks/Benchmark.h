@@ -0,0 +1,73 @@
+//
+//  Benchmark.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/*
+	Minimal micro benchmark harness for the engine's physics and math kernels.
+
+	Each benchmark is a function that runs its kernel a given number of times. The runner grows the iteration count until
+	a batch takes at least the minimum time, then times several batches and keeps the fastest and median nanoseconds per
+	iteration. The results are written as JSON so runs from different commits can be diffed.
+*/
+class BenchmarkRunner final
+{
+public:
+	//Runs the kernel being measured `iterations` times
+	using Kernel = std::function<void(const int iterations)>;
+
+	struct Result
+	{
+		std::string _Name;
+		int _Parameter = 0; //Problem size, such as vertex or collider count. 0 when the benchmark has none
+		int _Iterations = 0; //Per timed batch
+		double _MedianNanoseconds = 0.0; //Per iteration
+		double _FastestNanoseconds = 0.0; //Per iteration
+	};
+
+	BenchmarkRunner(const std::string& filter = "", const double& minimumBatchSeconds = 0.1, const int batches = 5);
+
+	void Run(const std::string& name, const int parameter, const Kernel& kernel);
+	void WriteJson(std::ostream& output) const;
+
+	const std::vector<Result>& GetResults() const { return _results; }
+
+private:
+	double TimeBatch(const Kernel& kernel, const int iterations) const;
+
+	std::vector<Result> _results;
+	std::string _filter; //Only benchmarks whose name contains the filter are run
+	double _minimumBatchSeconds = 0.1;
+	int _batches = 5;
+};
+
+/*
+	Hands a computed value to the optimizer as if it were used, so kernels whose results are otherwise ignored
+	aren't optimized away.
+*/
+template <typename T>
+void KeepAlive(const T& value)
+{
+	static volatile unsigned char SINK = 0;
+	SINK = SINK ^ *reinterpret_cast<const volatile unsigned char*>(&value); //Reading through volatile forces the value to be computed
+}
+
+namespace PhysicsBenchmarks
+{
+	void RunSeparatingAxisCollisionBenchmarks(BenchmarkRunner& runner);
+	void RunPolygonBenchmarks(BenchmarkRunner& runner);
+	void RunTransformBenchmarks(BenchmarkRunner& runner);
+	void RunRigidBodyBenchmarks(BenchmarkRunner& runner);
+	void RunCollisionResponseBenchmarks(BenchmarkRunner& runner);
+	void RunCollisionManagerBenchmarks(BenchmarkRunner& runner);
+}
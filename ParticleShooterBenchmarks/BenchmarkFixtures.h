@@ -0,0 +1,41 @@
+//
+//  BenchmarkFixtures.h
+//  Particle Shooter
+//
+//  Created by Ramy Fawaz in 2021
+//  Copyright (c) 2021 Ramy Fawaz. All rights reserved.
+//
+
+#pragma once
+
+#include "../ParticleShooter/Common/Vector2.h"
+#include "../ParticleShooter/Physics/Collider.h"
+
+#include <cmath>
+#include <vector>
+
+namespace PhysicsBenchmarks
+{
+	const int POLYGON_SIZES[] = { 3, 4, 8, 16, 32 }; //Vertex counts the SAT and Polygon kernels are measured at
+	const int COLLIDER_COUNTS[] = { 10, 100, 1000, 10000 }; //Scene sizes CollisionManager is measured at
+
+	//Vertices of a regular polygon centered on (radius, radius), wound clockwise like the game's colliders
+	inline std::vector<Vector2> RegularPolygon(const int vertexCount, const float radius)
+	{
+		std::vector<Vector2> vertices;
+		for (int i = 0; i < vertexCount; i++)
+		{
+			const double angle = 2.0 * 3.14159265358979 * i / vertexCount;
+			vertices.push_back(Vector2(static_cast<float>(radius + radius * std::sin(angle)), static_cast<float>(radius - radius * std::cos(angle))));
+		}
+
+		return vertices;
+	}
+
+	inline void BuildCollider(Collider& collider, const int vertexCount, const float radius, const Vector2& position, const RigidBody* rigidBody)
+	{
+		collider._Polygon.AddVertexPoint(RegularPolygon(vertexCount, radius));
+		collider.SetPosition(position);
+		collider.SetAssociatedRigidBody(rigidBody);
+	}
+}
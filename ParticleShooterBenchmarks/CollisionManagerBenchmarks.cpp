@@ -0,0 +1,47 @@
+#include "Benchmark.h"
+#include "BenchmarkFixtures.h"
+#include "../ParticleShooter/Physics/CollisionManager.h"
+
+#include <cmath>
+#include <memory>
+#include <random>
+
+namespace PhysicsBenchmarks
+{
+	/*
+		Description:
+			A full collision pass over N octagons scattered at a constant density, so the number of actual collisions
+			grows linearly while the number of pairs considered grows quadratically. The layout is seeded and identical
+			on every run. Response info is cleared after every pass, as Transform::ResolveCollisions does in game.
+	*/
+	void RunCollisionManagerBenchmarks(BenchmarkRunner& runner)
+	{
+		for (const int colliderCount : COLLIDER_COUNTS)
+		{
+			const float worldSize = 100.0f * std::sqrt(static_cast<float>(colliderCount));
+			std::mt19937 random(2021);
+			std::uniform_real_distribution<float> coordinate(0.0f, worldSize);
+
+			RigidBody rigidBody;
+			std::vector<std::unique_ptr<Collider>> colliders;
+			CollisionManager collisionManager;
+			for (int i = 0; i < colliderCount; i++)
+			{
+				colliders.push_back(std::make_unique<Collider>());
+				BuildCollider(*colliders.back(), 8, 16, Vector2(coordinate(random), coordinate(random)), &rigidBody);
+				colliders.back()->SetMinimumCollisionDistance(64);
+				collisionManager.AddCollider(colliders.back().get());
+			}
+
+			runner.Run("CollisionManager::SimulateCurrentCollisions", colliderCount, [&](const int iterations)
+			{
+				for (int i = 0; i < iterations; i++)
+				{
+					collisionManager.SimulateCurrentCollisions();
+					for (const std::unique_ptr<Collider>& collider : colliders)
+						collider->ClearCollisionResponseInfo();
+				}
+			});
+		}
+	}
+}
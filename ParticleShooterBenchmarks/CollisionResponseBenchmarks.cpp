@@ -0,0 +1,29 @@
+#include "Benchmark.h"
+#include "BenchmarkFixtures.h"
+#include "../ParticleShooter/Physics/CollisionResponse.h"
+#include "../ParticleShooter/Physics/RigidBody.h"
+
+namespace PhysicsBenchmarks
+{
+	/*
+		Description:
+			Two bodies moving into one another head on, matching the setup in CollisionResponseTests.
+	*/
+	void RunCollisionResponseBenchmarks(BenchmarkRunner& runner)
+	{
+		RigidBody rigidBodyA, rigidBodyB;
+		rigidBodyA.SetInputVelocity(Vector2(5, 0));
+		rigidBodyA.SetInvertedMass(0.1f);
+		rigidBodyA.SetElasticityCoefficient(1);
+		rigidBodyB.SetInputVelocity(Vector2(-3, 0));
+		rigidBodyB.SetInvertedMass(0.1f);
+		rigidBodyB.SetElasticityCoefficient(1);
+
+		const Vector2 collisionNormal(1, 0);
+		runner.Run("CollisionResponse::CalculateResultingImpulseVelocity", 0, [&](const int iterations)
+		{
+			for (int i = 0; i < iterations; i++)
+				KeepAlive(CollisionResponse::CalculateResultingImpulseVelocity(rigidBodyA, rigidBodyB, collisionNormal));
+		});
+	}
+}
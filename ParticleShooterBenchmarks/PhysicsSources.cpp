@@ -0,0 +1,12 @@
+//The engine sources under benchmark, compiled once into this project the same way ParticleShooterTests pulls them in
+#include "../ParticleShooter/Collider.cpp"
+#include "../ParticleShooter/CollisionManager.cpp"
+#include "../ParticleShooter/CollisionResponse.cpp"
+#include "../ParticleShooter/Common.cpp"
+#include "../ParticleShooter/ErrorHandler.cpp"
+#include "../ParticleShooter/NullRigidBody.cpp"
+#include "../ParticleShooter/Polygon.cpp"
+#include "../ParticleShooter/RigidBody.cpp"
+#include "../ParticleShooter/SeparatingAxisCollision.cpp"
+#include "../ParticleShooter/Transform.cpp"
+#include "../ParticleShooter/Vector2.cpp"
@@ -0,0 +1,28 @@
+#include "Benchmark.h"
+#include "BenchmarkFixtures.h"
+#include "../ParticleShooter/Physics/Polygon.h"
+
+namespace PhysicsBenchmarks
+{
+	/*
+		Description:
+			Rotation followed by the perpendicular recalculation it dirties, which is what collision detection pays for next.
+	*/
+	void RunPolygonBenchmarks(BenchmarkRunner& runner)
+	{
+		for (const int vertexCount : POLYGON_SIZES)
+		{
+			Polygon polygon;
+			polygon.AddVertexPoint(RegularPolygon(vertexCount, 20));
+
+			runner.Run("Polygon::Rotate", vertexCount, [&](const int iterations)
+			{
+				for (int i = 0; i < iterations; i++)
+				{
+					polygon.Rotate(1.5f);
+					KeepAlive(polygon.GetPerpendiculars()->front());
+				}
+			});
+		}
+	}
+}
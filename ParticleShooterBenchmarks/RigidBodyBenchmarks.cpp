@@ -0,0 +1,25 @@
+#include "Benchmark.h"
+#include "BenchmarkFixtures.h"
+#include "../ParticleShooter/Physics/RigidBody.h"
+
+namespace PhysicsBenchmarks
+{
+	/*
+		Description:
+			A single step of acceleration and deceleration, alternating direction so the velocity never settles at the speed cap.
+	*/
+	void RunRigidBodyBenchmarks(BenchmarkRunner& runner)
+	{
+		RigidBody rigidBody;
+		rigidBody.SetImpulseVelocity(Vector2(300, -200));
+
+		runner.Run("RigidBody::ApplyMovementForces", 0, [&](const int iterations)
+		{
+			for (int i = 0; i < iterations; i++)
+			{
+				rigidBody.SetAcceleration(i % 2 == 0 ? Vector2(1500, 500) : Vector2(-1500, -500));
+				KeepAlive(rigidBody.ApplyMovementForces());
+			}
+		});
+	}
+}
@@ -0,0 +1,32 @@
+#include "Benchmark.h"
+#include "BenchmarkFixtures.h"
+#include "../ParticleShooter/Physics/SeparatingAxisCollision.h"
+
+namespace PhysicsBenchmarks
+{
+	/*
+		Description:
+			Overlapping pairs of regular polygons, so IsColliding has to project onto every axis before answering.
+	*/
+	void RunSeparatingAxisCollisionBenchmarks(BenchmarkRunner& runner)
+	{
+		for (const int vertexCount : POLYGON_SIZES)
+		{
+			Collider colliderA, colliderB;
+			BuildCollider(colliderA, vertexCount, 20, Vector2(0, 0), nullptr);
+			BuildCollider(colliderB, vertexCount, 20, Vector2(15, 5), nullptr);
+
+			runner.Run("SeparatingAxisCollision::IsColliding", vertexCount, [&](const int iterations)
+			{
+				for (int i = 0; i < iterations; i++)
+					KeepAlive(SeparatingAxisCollision::IsColliding(&colliderA, &colliderB));
+			});
+
+			runner.Run("SeparatingAxisCollision::CalculateCollisionPoint", vertexCount, [&](const int iterations)
+			{
+				for (int i = 0; i < iterations; i++)
+					KeepAlive(SeparatingAxisCollision::CalculateCollisionPoint(&colliderA, &colliderB));
+			});
+		}
+	}
+}
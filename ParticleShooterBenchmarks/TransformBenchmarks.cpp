@@ -0,0 +1,29 @@
+#include "Benchmark.h"
+#include "BenchmarkFixtures.h"
+#include "../ParticleShooter/Physics/Transform.h"
+
+namespace PhysicsBenchmarks
+{
+	/*
+		Description:
+			Turning a Transform to face a new direction every call. Aligning the orientation also rotates the collider.
+	*/
+	void RunTransformBenchmarks(BenchmarkRunner& runner)
+	{
+		for (const int vertexCount : POLYGON_SIZES)
+		{
+			Transform transform(Rectangle(0, 0, 40, 40));
+			transform._Collider._Polygon.AddVertexPoint(RegularPolygon(vertexCount, 20));
+
+			const Vector2 directions[] = { Vector2(0, -1), Vector2(1, 0), Vector2(0.6f, 0.8f), Vector2(-0.8f, 0.6f) };
+			runner.Run("Transform::SetForwardVector", vertexCount, [&](const int iterations)
+			{
+				for (int i = 0; i < iterations; i++)
+				{
+					transform.SetForwardVector(directions[i % 4]);
+					KeepAlive(transform.GetOrientationAngle());
+				}
+			});
+		}
+	}
+}
@@ -193,6 +193,52 @@ namespace PhysicsTests
 			Assert::IsTrue(aCopy.GetCollisionResponseInfo()._Batons.size() == 3);
 		}
 
+		TEST_METHOD(Test_108_AddCollider_Batch_IgnoresDuplicates)
+		{
+			CollisionManager collisionManager;
+			Collider aCopy = _colliderA, bCopy = _colliderB, dCopy = _colliderD;
+
+			collisionManager.AddCollider(&aCopy);
+			collisionManager.AddCollider({ &aCopy, &bCopy, &dCopy, &dCopy }); //A is already registered and D is repeated
+
+			collisionManager.SimulateCurrentCollisions();
+
+			Assert::IsTrue(aCopy.GetCollisionResponseInfo()._IsColliding);
+			Assert::IsTrue(aCopy.GetCollisionResponseInfo()._Batons.size() == 1);
+			Assert::IsTrue(dCopy.GetCollisionResponseInfo()._Batons.size() == 1);
+		}
+
+		TEST_METHOD(Test_109_RemoveColliders_RemovedCollidersNoLongerCollide)
+		{
+			CollisionManager collisionManager;
+			Collider aCopy = _colliderA, bCopy = _colliderB, cCopy = _colliderC, dCopy = _colliderD;
+
+			collisionManager.AddCollider(&aCopy); //Would collide with D
+			collisionManager.AddCollider(&bCopy);
+			collisionManager.AddCollider(&cCopy);
+			collisionManager.AddCollider(&dCopy);
+			collisionManager.RemoveColliders({ &dCopy, &bCopy });
+
+			collisionManager.SimulateCurrentCollisions();
+
+			Assert::IsFalse(aCopy.GetCollisionResponseInfo()._IsColliding);
+			Assert::IsFalse(dCopy.GetCollisionResponseInfo()._IsColliding);
+		}
+
+		TEST_METHOD(Test_110_RemoveColliders_KeepsRemainingColliders)
+		{
+			CollisionManager collisionManager;
+			Collider aCopy = _colliderA, bCopy = _colliderB, cCopy = _colliderC, dCopy = _colliderD;
+
+			collisionManager.AddCollider({ &aCopy, &bCopy, &cCopy, &dCopy });
+			collisionManager.RemoveColliders({ &bCopy, &cCopy, &cCopy });
+
+			collisionManager.SimulateCurrentCollisions();
+
+			Assert::IsTrue(aCopy.GetCollisionResponseInfo()._IsColliding);
+			Assert::IsTrue(dCopy.GetCollisionResponseInfo()._IsColliding);
+		}
+
 
 	private:
 		Vector2 _origin;
@@ -113,6 +113,23 @@ namespace PhysicsTests
 			Assert::AreEqual(expectedNum, actualNum);
 		}
 
+		TEST_METHOD(Test_202_Copy_Shares_Vertices_Until_Rotated)
+		{
+			Polygon testPolygon;
+			testPolygon = _polygonA;
+
+			Assert::IsTrue(testPolygon.GetVertices() == _polygonA.GetVertices());
+			Assert::IsTrue(testPolygon.GetPerpendiculars() == _polygonA.GetPerpendiculars());
+			Assert::AreEqual(_polygonA.GetNumOfVertices(), testPolygon.GetNumOfVertices());
+
+			testPolygon.Rotate(90);
+
+			Assert::IsTrue(testPolygon.GetVertices() != _polygonA.GetVertices());
+			Assert::IsTrue(CommonHelpers::AreEqual(testPolygon.GetVertices()->at(0), Vector2(0, 1)));
+			Assert::IsTrue(CommonHelpers::AreEqual(_polygonA.GetVertices()->at(0), Vector2(1, 0)));
+			Assert::IsTrue(CommonHelpers::AreEqual(_polygonA.GetPerpendiculars()->at(0), ClockwisePerpendicularVector(Vector2(1, 0), Vector2(0, 1))));
+		}
+
 		TEST_METHOD(Test_301_ClockwisePerpendicular_InputVector_Zero_Two_OutputVector_Two_Zero)
 		{
 			const Vector2 inputVector(0, 2);
@@ -560,5 +560,66 @@ namespace PhysicsTests
 			Assert::IsTrue(CommonHelpers::AreEqual(resultingForward.x, expectedForward.x));
 			Assert::IsTrue(CommonHelpers::AreEqual(resultingForward.y, expectedForward.y));
 		}
+
+		TEST_METHOD(Test_501_GetInterpolatedOrigin_NoPreviousPose_ReturnsCurrentOrigin)
+		{
+			Transform testTransform;
+			testTransform.SetOrigin(100, 50);
+
+			const Vector2 resultingOrigin = testTransform.GetInterpolatedOrigin(0.0);
+
+			Assert::IsTrue(CommonHelpers::AreEqual(resultingOrigin.x, 100));
+			Assert::IsTrue(CommonHelpers::AreEqual(resultingOrigin.y, 50));
+		}
+
+		TEST_METHOD(Test_502_GetInterpolatedOrigin_HalfAlpha_ReturnsMidpoint)
+		{
+			Transform testTransform;
+			testTransform.SetOrigin(0, 0);
+			testTransform.StorePreviousPose();
+			testTransform.Move(100, -40);
+
+			const Vector2 resultingOrigin = testTransform.GetInterpolatedOrigin(0.5);
+
+			Assert::IsTrue(CommonHelpers::AreEqual(resultingOrigin.x, 50));
+			Assert::IsTrue(CommonHelpers::AreEqual(resultingOrigin.y, -20));
+		}
+
+		TEST_METHOD(Test_503_GetInterpolatedOrigin_FullAlpha_ReturnsCurrentOrigin)
+		{
+			Transform testTransform;
+			testTransform.SetOrigin(10, 10);
+			testTransform.StorePreviousPose();
+			testTransform.Move(30, 30);
+
+			const Vector2 resultingOrigin = testTransform.GetInterpolatedOrigin(1.0);
+
+			Assert::IsTrue(CommonHelpers::AreEqual(resultingOrigin.x, 40));
+			Assert::IsTrue(CommonHelpers::AreEqual(resultingOrigin.y, 40));
+		}
+
+		TEST_METHOD(Test_504_GetInterpolatedOrientationAngle_HalfAlpha_ReturnsMidAngle)
+		{
+			Transform testTransform;
+			testTransform.SetOrientationAngle(0);
+			testTransform.StorePreviousPose();
+			testTransform.SetOrientationAngle(90);
+
+			const double resultingOrientation = testTransform.GetInterpolatedOrientationAngle(0.5);
+
+			Assert::IsTrue(CommonHelpers::AreEqual(resultingOrientation, 45));
+		}
+
+		TEST_METHOD(Test_505_GetInterpolatedOrientationAngle_CrossingHalfTurn_TurnsShortWay)
+		{
+			Transform testTransform;
+			testTransform.SetOrientationAngle(170);
+			testTransform.StorePreviousPose();
+			testTransform.SetOrientationAngle(-170);
+
+			const double resultingOrientation = testTransform.GetInterpolatedOrientationAngle(0.5);
+
+			Assert::IsTrue(CommonHelpers::AreEqual(resultingOrientation, 180));
+		}
 	};
 }
\ No newline at end of file